@@ -2,6 +2,7 @@
 
 #include "art/Framework/Art/detail/AllowedConfiguration.h"
 #include "art/Framework/Art/detail/info_success.h"
+#include "art/Framework/Art/detail/parse_config_cached.h"
 #include "art/Utilities/PluginSuffixes.h"
 #include "art/Version/GetReleaseVersion.h"
 #include "canvas/Utilities/Exception.h"
@@ -35,6 +36,11 @@ art::BasicOptionsHandler::BasicOptionsHandler(bpo::options_description& desc,
     ("help,h", "produce help message")
     ("version", ("Print art version (" + getReleaseVersion() + ")").c_str())
     ("config,c", bpo::value<std::string>(), "Configuration file.")
+    ("config-cache",
+       bpo::value<std::string>(),
+       "Directory in which to keep the processed configuration file for "
+       "reuse by later jobs with the same configuration.  Command-line "
+       "overrides are applied after the cached configuration is read.")
     ("process-name", bpo::value<std::string>(), "art process name.")
     ("prune-config",
        bpo::value<bool>()->default_value(true, to_string(true)),
@@ -121,7 +127,12 @@ art::BasicOptionsHandler::doProcessOptions(
   fhicl::intermediate_table& raw_config)
 {
   try {
-    raw_config = fhicl::parse_document(vm["config"].as<std::string>(), maker_);
+    auto const& config = vm["config"].as<std::string>();
+    raw_config =
+      vm.count("config-cache") ?
+        detail::parse_config_cached(
+          config, maker_, vm["config-cache"].as<std::string>()) :
+        fhicl::parse_document(config, maker_);
   }
   catch (cet::exception& e) {
     std::cerr << "Failed to parse the configuration file '"
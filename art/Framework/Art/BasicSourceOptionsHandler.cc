@@ -26,6 +26,10 @@ art::BasicSourceOptionsHandler::BasicSourceOptionsHandler(
        bpo::value<std::string>(),
        "EventID of first event to process (e.g. '1:2:4' starts event "
        "processing at run 1, subrun2, event 4).")
+    ("event-list",
+       bpo::value<std::string>(),
+       "File listing the events to process, one '<run>:<subrun>:<event>' "
+       "per line; all other events are skipped.")
     ("nevts,n", bpo::value<int>(), "Number of events to process.")
     ("nskip", bpo::value<unsigned long>(), "Number of events to skip.");
   // clang-format on
@@ -63,6 +67,9 @@ art::BasicSourceOptionsHandler::doProcessOptions(
     raw_config.put("source.firstSubRun", subRun);
     raw_config.put("source.firstEvent", event);
   }
+  if (vm.count("event-list")) {
+    raw_config.put("source.eventListFile", vm["event-list"].as<std::string>());
+  }
   if (vm.count("nskip")) {
     raw_config.put("source.skipEvents", vm["nskip"].as<unsigned long>());
   }
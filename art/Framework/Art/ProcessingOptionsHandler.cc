@@ -63,6 +63,17 @@ art::ProcessingOptionsHandler::ProcessingOptionsHandler(
        bpo::value<int>(),
        "Number of threads to use for event processing (default = 1, 0 = all "
        "cores)")
+    ("nreplicas",
+       bpo::value<int>(),
+       "Number of copies to make of each replicated module, shared by the "
+       "schedules when fewer than --nschedules (default = one per schedule).")
+    ("nprocesses",
+       bpo::value<int>(),
+       "Number of worker processes to fork after beginJob, each processing "
+       "every nth subrun (default = 1).")
+    ("rebuild-plugin-cache",
+       "Rebuild the on-disk index of plugin libraries, even if it appears to "
+       "be current.")
     ("default-exceptions",
        "Some exceptions may be handled differently by default (e.g. "
        "ProductNotFound).")
@@ -110,6 +121,14 @@ art::ProcessingOptionsHandler::doCheckOptions(bpo::variables_map const& vm)
     throw Exception(errors::Configuration)
       << "Option --nschedules must be at least 1.\n";
   }
+  if (vm.count("nreplicas") and vm["nreplicas"].as<int>() < 1) {
+    throw Exception(errors::Configuration)
+      << "Option --nreplicas must be at least 1.\n";
+  }
+  if (vm.count("nprocesses") and vm["nprocesses"].as<int>() < 1) {
+    throw Exception(errors::Configuration)
+      << "Option --nprocesses must be at least 1.\n";
+  }
   return 0;
 }
 
@@ -141,6 +160,20 @@ art::ProcessingOptionsHandler::doProcessOptions(
             raw_config,
             true);
 
+  if (vm.count("rebuild-plugin-cache")) {
+    raw_config.put(fhicl_key(scheduler_key, "rebuildPluginCache"), true);
+  }
+
+  if (vm.count("nreplicas")) {
+    raw_config.put(fhicl_key(scheduler_key, "num_replicas"),
+                   vm["nreplicas"].as<int>());
+  }
+
+  if (vm.count("nprocesses")) {
+    raw_config.put(fhicl_key(scheduler_key, "num_processes"),
+                   vm["nprocesses"].as<int>());
+  }
+
   auto const num_schedules_key = fhicl_key(scheduler_key, "num_schedules");
   auto const num_threads_key = fhicl_key(scheduler_key, "num_threads");
   if (vm.count("parallelism")) {
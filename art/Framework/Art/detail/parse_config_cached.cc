@@ -0,0 +1,234 @@
+#include "art/Framework/Art/detail/parse_config_cached.h"
+// vim: set sw=2 expandtab :
+
+#include "cetlib/filepath_maker.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "fhiclcpp/extended_value.h"
+#include "fhiclcpp/intermediate_table.h"
+#include "fhiclcpp/parse.h"
+
+#include "boost/filesystem.hpp"
+
+#include <algorithm>
+#include <any>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+extern "C" {
+#include <unistd.h>
+}
+
+using namespace std::string_literals;
+
+namespace {
+
+  std::string const cache_header{"art_config_cache 1"};
+
+  std::uint64_t
+  fnv1a(std::string const& s,
+        std::uint64_t hash = 14695981039346656037ull) noexcept
+  {
+    for (unsigned char const c : s) {
+      hash = (hash ^ c) * 1099511628211ull;
+    }
+    return hash;
+  }
+
+  std::string
+  to_hex(std::uint64_t const hash)
+  {
+    std::ostringstream os;
+    os << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return os.str();
+  }
+
+  // Empty if the file cannot be read.
+  std::string
+  content_hash(std::string const& path)
+  {
+    std::ifstream is{path, std::ios::binary};
+    if (!is) {
+      return {};
+    }
+    std::ostringstream contents;
+    contents << is.rdbuf();
+    return to_hex(fnv1a(contents.str()));
+  }
+
+  struct SourceFile {
+    std::string hash;
+    std::string path;
+  };
+
+  // Records every file the parser is directed to.
+  class recording_maker : public cet::filepath_maker {
+  public:
+    explicit recording_maker(cet::filepath_maker& maker) : maker_{maker} {}
+
+    std::string
+    operator()(std::string const& filename) override
+    {
+      auto path = maker_(filename);
+      files_.push_back({content_hash(path), path});
+      return path;
+    }
+
+    std::vector<SourceFile> const&
+    files() const noexcept
+    {
+      return files_;
+    }
+
+  private:
+    cet::filepath_maker& maker_;
+    std::vector<SourceFile> files_{};
+  };
+
+  bool
+  uses_protection(fhicl::extended_value const& value)
+  {
+    using table_t = fhicl::extended_value::table_t;
+    using sequence_t = fhicl::extended_value::sequence_t;
+    if (value.protection != fhicl::Protection::NONE) {
+      return true;
+    }
+    if (value.is_a(fhicl::TABLE)) {
+      auto const& table = std::any_cast<table_t const&>(value.value);
+      for (auto const& [name, entry] : table) {
+        if (uses_protection(entry)) {
+          return true;
+        }
+      }
+    } else if (value.is_a(fhicl::SEQUENCE)) {
+      auto const& sequence = std::any_cast<sequence_t const&>(value.value);
+      for (auto const& entry : sequence) {
+        if (uses_protection(entry)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  bool
+  uses_protection(fhicl::intermediate_table const& table)
+  {
+    for (auto const& [name, value] : table) {
+      if (uses_protection(value)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::string
+  cache_file(std::string const& filename, std::string const& cache_dir)
+  {
+    auto hash = fnv1a(filename);
+    if (auto const* path = std::getenv("FHICL_FILE_PATH")) {
+      hash = fnv1a("\0"s + path, hash);
+    }
+    return cache_dir + "/config_" + to_hex(hash);
+  }
+
+  // Returns true, with the cached document in 'config', if none of
+  // the recorded files has changed.
+  bool
+  read_cache(std::string const& file, std::string& config)
+  {
+    std::ifstream is{file};
+    std::string line;
+    if (!std::getline(is, line) || line != cache_header) {
+      return false;
+    }
+    while (std::getline(is, line)) {
+      if (line.size() < 2 || line[1] != ' ') {
+        return false;
+      }
+      if (line[0] == 'F') {
+        std::istringstream ls{line.substr(2)};
+        SourceFile source;
+        ls >> source.hash;
+        ls.get();
+        std::getline(ls, source.path);
+        if (source.hash.empty() || content_hash(source.path) != source.hash) {
+          return false;
+        }
+      } else if (line[0] == 'C') {
+        // The document is the remainder of the file.
+        std::ostringstream rest;
+        rest << is.rdbuf();
+        config = line.substr(2);
+        if (!rest.str().empty()) {
+          config += '\n' + rest.str();
+        }
+        return true;
+      } else {
+        return false;
+      }
+    }
+    return false;
+  }
+
+  void
+  write_cache(std::string const& file,
+              std::vector<SourceFile> const& sources,
+              std::string const& config)
+  {
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(
+      boost::filesystem::path{file}.parent_path(), ec);
+    if (ec) {
+      return;
+    }
+    // Written aside and renamed, so that concurrent jobs never see a
+    // partial file.
+    auto const tmp = file + '.' + std::to_string(getpid());
+    {
+      std::ofstream os{tmp};
+      os << cache_header << '\n';
+      for (auto const& source : sources) {
+        os << "F " << source.hash << ' ' << source.path << '\n';
+      }
+      os << "C " << config;
+      if (!os) {
+        std::remove(tmp.c_str());
+        return;
+      }
+    }
+    if (std::rename(tmp.c_str(), file.c_str()) != 0) {
+      std::remove(tmp.c_str());
+    }
+  }
+
+} // namespace
+
+fhicl::intermediate_table
+art::detail::parse_config_cached(std::string const& filename,
+                                 cet::filepath_maker& maker,
+                                 std::string const& cache_dir)
+{
+  auto const file = cache_file(filename, cache_dir);
+  if (std::string config; read_cache(file, config)) {
+    return fhicl::parse_document(config);
+  }
+
+  recording_maker recorder{maker};
+  auto result = fhicl::parse_document(filename, recorder);
+  auto const& sources = recorder.files();
+  bool const all_read = std::none_of(
+    sources.cbegin(), sources.cend(), [](auto const& source) {
+      return source.hash.empty();
+    });
+  // The full form is written: the compact form refers to nested
+  // tables by ID, which only the registry of this process can resolve.
+  if (all_read && !uses_protection(result)) {
+    write_cache(file, sources, fhicl::ParameterSet::make(result).to_string());
+  }
+  return result;
+}
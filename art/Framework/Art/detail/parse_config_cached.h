@@ -0,0 +1,48 @@
+#ifndef art_Framework_Art_detail_parse_config_cached_h
+#define art_Framework_Art_detail_parse_config_cached_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// parse_config_cached
+//
+// Parses a configuration file as fhicl::parse_document does, reusing
+// the result of an earlier parse of the same file when none of the
+// files it read--the configuration file itself and everything it
+// #includes--has changed since.
+//
+// The processed document is kept in <cache_dir> as the compact string
+// of its ParameterSet (i.e. with the #includes, prologs and @local,
+// @table and @sequence references already resolved), together with a
+// content hash of each file that was read.  The cache entry is keyed
+// by the configuration-file name and FHICL_FILE_PATH; it is reused
+// only if every recorded file still has the same contents, and is
+// rewritten otherwise.  The result is an ordinary intermediate table,
+// so that all command-line overrides are applied to it as before.
+//
+// Documents that use @protect_ignore or @protect_error are not cached,
+// as those annotations do not survive the conversion to a
+// ParameterSet.  A cache that cannot be written is silently ignored.
+//
+// Note that a newly-added file that shadows one of the recorded files
+// on FHICL_FILE_PATH is not detected.
+// ======================================================================
+
+#include "fhiclcpp/fwd.h"
+
+#include <string>
+
+namespace cet {
+  class filepath_maker;
+}
+
+namespace art::detail {
+  fhicl::intermediate_table parse_config_cached(std::string const& filename,
+                                                cet::filepath_maker& maker,
+                                                std::string const& cache_dir);
+}
+
+#endif /* art_Framework_Art_detail_parse_config_cached_h */
+
+// Local Variables:
+// mode: c++
+// End:
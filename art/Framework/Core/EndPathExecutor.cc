@@ -206,34 +206,6 @@ namespace art {
     }
   }
 
-  //
-  //  MEMBER FUNCTIONS -- Process Non-Event
-  //
-
-  void
-  EndPathExecutor::process(Transition trans, Principal& principal)
-  {
-    for (auto& worker : unique_workers(endPathInfo_)) {
-      worker.reset();
-    }
-    try {
-      if (!endPathInfo_.paths().empty()) {
-        endPathInfo_.paths().front().process(trans, principal);
-      }
-    }
-    catch (cet::exception& ex) {
-      throw Exception(errors::EventProcessorFailure, "EndPathExecutor:")
-        << "an exception occurred during current event processing\n"
-        << ex;
-    }
-    catch (...) {
-      mf::LogError("PassingThrough")
-        << "an exception occurred during current event processing\n";
-      throw;
-    }
-    endPathInfo_.incrementPassedEventCount();
-  }
-
   class EndPathExecutor::PathsDoneTask {
   public:
     PathsDoneTask(EndPathExecutor* const endPathExec,
@@ -284,6 +256,51 @@ namespace art {
     GlobalTaskGroup& taskGroup_;
   };
 
+  //
+  //  MEMBER FUNCTIONS -- Process Non-Event
+  //
+
+  void
+  EndPathExecutor::process(WaitingTaskPtr transitionDoneTask,
+                           Transition const trans,
+                           Principal& principal)
+  {
+    auto const sid = sc_.id();
+    TDEBUG_BEGIN_FUNC_SI(4, sid);
+    for (auto& worker : unique_workers(endPathInfo_)) {
+      worker.reset();
+    }
+    try {
+      auto pathsDoneTask =
+        make_waiting_task<PathsDoneTask>(this, transitionDoneTask, taskGroup_);
+      if (endPathInfo_.paths().empty()) {
+        taskGroup_.may_run(pathsDoneTask);
+      } else {
+        endPathInfo_.paths().front().process(pathsDoneTask, trans, principal);
+      }
+    }
+    catch (...) {
+      taskGroup_.may_run(transitionDoneTask, current_exception());
+    }
+    TDEBUG_END_FUNC_SI(4, sid);
+  }
+
+  void
+  EndPathExecutor::invokePrePathSignals(Transition const trans)
+  {
+    for (auto& path : endPathInfo_.paths()) {
+      path.invokePreTransitionSignal(trans);
+    }
+  }
+
+  void
+  EndPathExecutor::invokePostPathSignals(Transition const trans) const
+  {
+    for (auto const& path : endPathInfo_.paths()) {
+      path.invokePostTransitionSignal(trans);
+    }
+  }
+
   // Note: We come here as part of the endPath task, our
   // parent task is the eventLoop task.
   void
@@ -74,7 +74,11 @@ namespace art {
     void writeSubRun(SubRunPrincipal& srp);
 
     // Process Run/SubRun
-    void process(Transition, Principal&);
+    void process(hep::concurrency::WaitingTaskPtr transitionDoneTask,
+                 Transition,
+                 Principal&);
+    void invokePrePathSignals(Transition);
+    void invokePostPathSignals(Transition) const;
 
     // Process Event
     //
@@ -11,10 +11,13 @@
 #include "fhiclcpp/ParameterSetID.h"
 #include "fhiclcpp/ParameterSetRegistry.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
-#include "range/v3/view.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
+#include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -86,35 +89,6 @@ namespace {
     return false;
   }
 
-  // Indicate if any bit in the trigger results matches the desired value
-  // at that position, based on the bits array.  If s is Exception, this
-  // looks for a Exceptionmatch; otherwise, true-->Pass, false-->Fail.
-  bool
-  any_bit(vector<BitInfo> const& bits,
-          HLTGlobalStatus const& tr,
-          hlt::HLTState const s = hlt::Ready)
-  {
-    bool const check_for_exception = (s == hlt::Exception);
-    return std::any_of(
-      begin(bits), end(bits), [check_for_exception, &tr](auto const& b) {
-        hlt::HLTState const bstate = check_for_exception ? hlt::Exception :
-                                     b.accept_state      ? hlt::Pass :
-                                                           hlt::Fail;
-        return tr.at(b.pos).state() == bstate;
-      });
-  }
-
-  // Indicate if *every* bit in the trigger results matches the desired value
-  // at that position, based on the bits array: true-->Pass, false-->Fail.
-  bool
-  all_bits(vector<BitInfo> const& bits, HLTGlobalStatus const& tr)
-  {
-    return std::all_of(begin(bits), end(bits), [&tr](auto const& b) {
-      hlt::HLTState const bstate = b.accept_state ? hlt::Pass : hlt::Fail;
-      return tr.at(b.pos).state() == bstate;
-    });
-  }
-
   bool
   accept_all(vector<string> const& path_specs)
   {
@@ -145,8 +119,218 @@ namespace {
 
 namespace art {
 
+  // The path states of a TriggerResults object are packed into three
+  // bitmasks (Pass, Fail, and Exception), each of which occupies
+  // 'nwords_' 64-bit words.  Every selection criterion is then a
+  // bitmask over the path positions, and evaluating it requires only
+  // a few AND/compare operations per word.
+  class EventSelector::Program {
+  public:
+    using word_t = std::uint64_t;
+    using Mask = std::vector<word_t>;
+
+    explicit Program(std::size_t const npaths)
+      : npaths_{npaths}
+      , nwords_{(npaths + bits_per_word - 1) / bits_per_word}
+      , absolute_pass_(nwords_)
+      , absolute_fail_(nwords_)
+      , conditional_pass_(nwords_)
+      , conditional_fail_(nwords_)
+      , exception_(nwords_)
+    {}
+
+    Mask
+    make_mask() const
+    {
+      return Mask(nwords_);
+    }
+
+    static void
+    set(Mask& mask, BitInfo const& b)
+    {
+      mask[b.pos / bits_per_word] |= word_t{1} << (b.pos % bits_per_word);
+    }
+
+    void
+    add_absolute(BitInfo const& b)
+    {
+      set(b.accept_state ? absolute_pass_ : absolute_fail_, b);
+    }
+
+    void
+    add_conditional(BitInfo const& b)
+    {
+      set(b.accept_state ? conditional_pass_ : conditional_fail_, b);
+    }
+
+    void
+    add_exception(BitInfo const& b)
+    {
+      set(exception_, b);
+    }
+
+    void
+    add_all_must_fail(Mask mask, bool const noexception)
+    {
+      (noexception ? all_must_fail_noex_ : all_must_fail_)
+        .push_back(std::move(mask));
+    }
+
+    std::size_t
+    npaths() const noexcept
+    {
+      return npaths_;
+    }
+
+    bool
+    accepts(HLTGlobalStatus const& tr) const
+    {
+      // Avoid a heap allocation for the common case of a modest
+      // number of trigger paths.
+      constexpr std::size_t max_local_words{4};
+      if (nwords_ <= max_local_words) {
+        std::array<word_t, 3 * max_local_words> states{};
+        return accepts_(pack_(tr, states.data()));
+      }
+      std::vector<word_t> states(3 * nwords_);
+      return accepts_(pack_(tr, states.data()));
+    }
+
+  private:
+    static constexpr std::size_t bits_per_word{64};
+
+    struct PackedStates {
+      word_t const* pass;
+      word_t const* fail;
+      word_t const* except;
+    };
+
+    PackedStates
+    pack_(HLTGlobalStatus const& tr, word_t* const states) const
+    {
+      auto* const pass = states;
+      auto* const fail = states + nwords_;
+      auto* const except = states + 2 * nwords_;
+      for (std::size_t i = 0; i != npaths_; ++i) {
+        auto const bit = word_t{1} << (i % bits_per_word);
+        switch (tr.at(i).state()) {
+        case hlt::Pass:
+          pass[i / bits_per_word] |= bit;
+          break;
+        case hlt::Fail:
+          fail[i / bits_per_word] |= bit;
+          break;
+        case hlt::Exception:
+          except[i / bits_per_word] |= bit;
+          break;
+        default:
+          break;
+        }
+      }
+      return {pass, fail, except};
+    }
+
+    bool
+    any_(word_t const* states, Mask const& mask) const
+    {
+      for (std::size_t w = 0; w != nwords_; ++w) {
+        if (states[w] & mask[w]) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    bool
+    any_(PackedStates const& s, Mask const& pass, Mask const& fail) const
+    {
+      for (std::size_t w = 0; w != nwords_; ++w) {
+        if ((s.pass[w] & pass[w]) | (s.fail[w] & fail[w])) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    bool
+    all_fail_(PackedStates const& s, Mask const& mask) const
+    {
+      for (std::size_t w = 0; w != nwords_; ++w) {
+        if ((s.fail[w] & mask[w]) != mask[w]) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    bool
+    error_(PackedStates const& s) const
+    {
+      return std::any_of(
+        s.except, s.except + nwords_, [](word_t const w) { return w != 0; });
+    }
+
+    bool
+    accepts_(PackedStates const& s) const
+    {
+      if (any_(s, absolute_pass_, absolute_fail_)) {
+        return true;
+      }
+
+      bool exceptionPresent = false;
+      bool exceptionsLookedFor = false;
+      if (any_(s, conditional_pass_, conditional_fail_)) {
+        exceptionPresent = error_(s);
+        if (!exceptionPresent) {
+          return true;
+        }
+        exceptionsLookedFor = true;
+      }
+
+      if (any_(s.except, exception_)) {
+        return true;
+      }
+
+      for (auto const& f : all_must_fail_) {
+        if (all_fail_(s, f)) {
+          return true;
+        }
+      }
+
+      for (auto const& fn : all_must_fail_noex_) {
+        if (all_fail_(s, fn)) {
+          if (!exceptionsLookedFor) {
+            exceptionPresent = error_(s);
+          }
+          return !exceptionPresent;
+        }
+      }
+      return false;
+    }
+
+    std::size_t const npaths_;
+    std::size_t const nwords_;
+    Mask absolute_pass_;
+    Mask absolute_fail_;
+    Mask conditional_pass_;
+    Mask conditional_fail_;
+    Mask exception_;
+    std::vector<Mask> all_must_fail_{};
+    std::vector<Mask> all_must_fail_noex_{};
+  };
+
+  // Compiled programs, indexed by the trigger-path names for which
+  // they were compiled.
+  struct EventSelector::ProgramCache {
+    std::mutex mutex{};
+    std::map<std::vector<std::string>, std::shared_ptr<Program const>>
+      programs{};
+  };
+
   EventSelector::EventSelector(vector<string> const& pathspecs)
-    : path_specs_{pathspecs}, accept_all_{accept_all(path_specs_)}
+    : path_specs_{pathspecs}
+    , accept_all_{accept_all(path_specs_)}
+    , programs_{std::make_shared<ProgramCache>()}
   {
     acceptors_.expand_to_num_schedules();
   }
@@ -155,9 +339,10 @@ namespace art {
   EventSelector::EventSelector(EventSelector&&) = default;
   EventSelector::~EventSelector() = default;
 
-  // This should be called per new file.
-  EventSelector::ScheduleData
-  EventSelector::data_for(TriggerResults const& tr) const
+  // This is called whenever the TriggerResults' configuration changes
+  // (typically once per input file).
+  std::shared_ptr<EventSelector::Program const>
+  EventSelector::program_for(TriggerResults const& tr) const
   {
     fhicl::ParameterSet pset;
     if (!fhicl::ParameterSetRegistry::get(tr.parameterSetID(), pset)) {
@@ -181,11 +366,27 @@ namespace art {
         << "the art developers.\n";
     }
 
-    std::vector<BitInfo> absolute_acceptors;
-    std::vector<BitInfo> conditional_acceptors;
-    std::vector<BitInfo> exception_acceptors;
-    std::vector<std::vector<BitInfo>> all_must_fail;
-    std::vector<std::vector<BitInfo>> all_must_fail_noex;
+    {
+      std::lock_guard lock{programs_->mutex};
+      if (auto it = programs_->programs.find(trigger_path_specs);
+          it != programs_->programs.cend()) {
+        return it->second;
+      }
+    }
+
+    // Compilation is done without holding the lock; should two
+    // schedules compile the same program concurrently, the first one
+    // inserted is kept.
+    auto program = compile(trigger_path_specs);
+    std::lock_guard lock{programs_->mutex};
+    return programs_->programs.try_emplace(trigger_path_specs, move(program))
+      .first->second;
+  }
+
+  std::shared_ptr<EventSelector::Program const>
+  EventSelector::compile(vector<string> const& trigger_path_specs) const
+  {
+    auto program = std::make_shared<Program>(trigger_path_specs.size());
 
     for (string const& pathSpecifier : path_specs_) {
       string specifier{pathSpecifier};
@@ -244,71 +445,53 @@ namespace art {
       };
 
       if (!negative_criterion && !noex_demanded && !exception_spec) {
-        cet::transform_all(
-          matches, back_inserter(absolute_acceptors), makeBitInfoPass);
+        for (auto m : matches) {
+          program->add_absolute(makeBitInfoPass(m));
+        }
         continue;
       }
 
       if (!negative_criterion && noex_demanded) {
-        cet::transform_all(
-          matches, back_inserter(conditional_acceptors), makeBitInfoPass);
+        for (auto m : matches) {
+          program->add_conditional(makeBitInfoPass(m));
+        }
         continue;
       }
 
       if (exception_spec) {
-        cet::transform_all(
-          matches, back_inserter(exception_acceptors), makeBitInfoPass);
+        for (auto m : matches) {
+          program->add_exception(makeBitInfoPass(m));
+        }
         continue;
       }
 
-      if (negative_criterion && !noex_demanded) {
-        if (matches.empty()) {
-          throw Exception(errors::Configuration)
-            << "EventSelector::init, A module is using SelectEvents\n"
-               "to request all fails on a set of trigger names that do not "
-               "exist\n"
-            << "The problematic name is: " << pathSpecifier << '\n';
-        }
+      if (matches.empty()) {
+        throw Exception(errors::Configuration)
+          << "EventSelector::init, A module is using SelectEvents\n"
+             "to request all fails on a set of trigger names that do not "
+             "exist\n"
+          << "The problematic name is: " << pathSpecifier << '\n';
+      }
 
-        if (matches.size() == 1) {
-          BitInfo bi{path_position(trigger_path_specs, matches[0]), false};
-          absolute_acceptors.push_back(bi);
+      // From here on, the criterion is negative.
+      if (matches.size() == 1) {
+        auto const bi = makeBitInfoFail(matches[0]);
+        if (noex_demanded) {
+          program->add_conditional(bi);
         } else {
-          // We set this to false because that will demand bits are Fail.
-          auto must_fail = matches |
-                           ::ranges::views::transform(makeBitInfoFail) |
-                           ::ranges::to_vector;
-          all_must_fail.push_back(std::move(must_fail));
+          program->add_absolute(bi);
         }
         continue;
       }
 
-      if (negative_criterion && noex_demanded) {
-        if (matches.empty()) {
-          throw Exception(errors::Configuration)
-            << "EventSelector::init, A module is using SelectEvents\n"
-               "to request all fails on a set of trigger names that do not "
-               "exist\n"
-            << "The problematic name is: " << pathSpecifier << '\n';
-        }
-
-        if (matches.size() == 1) {
-          BitInfo bi{path_position(trigger_path_specs, matches[0]), false};
-          conditional_acceptors.push_back(bi);
-        } else {
-          auto must_fail = matches |
-                           ::ranges::views::transform(makeBitInfoFail) |
-                           ::ranges::to_vector;
-          all_must_fail_noex.push_back(std::move(must_fail));
-        }
+      // All matching paths must fail.
+      auto must_fail = program->make_mask();
+      for (auto m : matches) {
+        Program::set(must_fail, makeBitInfoFail(m));
       }
+      program->add_all_must_fail(std::move(must_fail), noex_demanded);
     }
-    return ScheduleData{tr.parameterSetID(),
-                        absolute_acceptors,
-                        conditional_acceptors,
-                        exception_acceptors,
-                        all_must_fail,
-                        all_must_fail_noex};
+    return program;
   }
 
   bool
@@ -320,53 +503,11 @@ namespace art {
     }
 
     auto& data = acceptors_.at(id);
-    if (data.psetID != tr.parameterSetID()) {
-      data = data_for(tr);
-    }
-    return selectionDecision(data, tr);
-  }
-
-  bool
-  EventSelector::selectionDecision(ScheduleData const& data,
-                                   HLTGlobalStatus const& tr) const
-  {
-    if (accept_all_) {
-      return true;
-    }
-
-    if (any_bit(data.absolute_acceptors, tr)) {
-      return true;
-    }
-
-    bool exceptionPresent = false;
-    bool exceptionsLookedFor = false;
-    if (any_bit(data.conditional_acceptors, tr)) {
-      exceptionPresent = tr.error();
-      if (!exceptionPresent) {
-        return true;
-      }
-      exceptionsLookedFor = true;
-    }
-
-    if (any_bit(data.exception_acceptors, tr, hlt::Exception)) {
-      return true;
-    }
-
-    for (auto const& f : data.all_must_fail) {
-      if (all_bits(f, tr)) {
-        return true;
-      }
+    if (!data.program || data.psetID != tr.parameterSetID()) {
+      data.program = program_for(tr);
+      data.psetID = tr.parameterSetID();
     }
-
-    for (auto const& fn : data.all_must_fail_noex) {
-      if (all_bits(fn, tr)) {
-        if (!exceptionsLookedFor) {
-          exceptionPresent = tr.error();
-        }
-        return !exceptionPresent;
-      }
-    }
-    return false;
+    return data.program->accepts(tr);
   }
 
 } // namespace art
@@ -2,7 +2,7 @@
 #define art_Framework_Core_EventSelector_h
 // vim: set sw=2 expandtab :
 
-#include "art/Utilities/PerScheduleContainer.h"
+#include "art/Utilities/PaddedPerScheduleContainer.h"
 #include "canvas/Persistency/Common/fwd.h"
 #include "fhiclcpp/ParameterSetID.h"
 
@@ -26,21 +26,25 @@ namespace art {
     };
 
   private:
+    // The selection criteria, compiled for one set of trigger-path
+    // names into bitmasks over the packed path states.
+    class Program;
+    struct ProgramCache;
+
     std::vector<std::string> const path_specs_;
     bool const accept_all_;
+    // Shared by all copies of this selector, and reused across input
+    // files that have the same trigger-path names.
+    std::shared_ptr<ProgramCache> programs_;
     struct ScheduleData {
       fhicl::ParameterSetID psetID{};
-      std::vector<BitInfo> absolute_acceptors;
-      std::vector<BitInfo> conditional_acceptors;
-      std::vector<BitInfo> exception_acceptors;
-      std::vector<std::vector<BitInfo>> all_must_fail;
-      std::vector<std::vector<BitInfo>> all_must_fail_noex;
+      std::shared_ptr<Program const> program{};
     };
-    PerScheduleContainer<ScheduleData> mutable acceptors_;
+    PaddedPerScheduleContainer<ScheduleData> mutable acceptors_;
 
-    ScheduleData data_for(TriggerResults const& tr) const;
-    bool selectionDecision(ScheduleData const& data,
-                           HLTGlobalStatus const&) const;
+    std::shared_ptr<Program const> program_for(TriggerResults const& tr) const;
+    std::shared_ptr<Program const> compile(
+      std::vector<std::string> const& trigger_path_specs) const;
   };
 
 } // namespace art
@@ -3,9 +3,9 @@
 #include "art/Framework/Core/GroupSelectorRules.h"
 #include "canvas/Persistency/Provenance/BranchDescription.h"
 #include "cetlib/container_algorithms.h"
-#include "range/v3/action/sort.hpp"
 #include "range/v3/view.hpp"
 
+#include <algorithm>
 #include <ostream>
 #include <utility>
 
@@ -29,30 +29,61 @@ GroupSelector::GroupSelector(GroupSelectorRules const& rules,
   // override any previous rule, or all previous rules.
   rules.applyToAll(branchstates);
 
-  // For each of the BranchSelectStates that indicates the branch is
-  // to be selected, remember the branch.  The list of branch pointers
-  // must be sorted for subsequent binary search to work.
-  groupsToSelect_ =
-    branchstates |
-    ::ranges::views::filter([](auto const& state) { return state.selectMe; }) |
-    ::ranges::views::transform([](auto const& state) { return state.desc; }) |
-    ::ranges::to<std::vector>();
-  sort_all(groupsToSelect_);
+  // Record the decision for each product in a dense bitmap, with the
+  // slots ordered by ProductID.
+  vector<pair<ProductID, bool>> decisions;
+  decisions.reserve(branchstates.size());
+  for (auto const& state : branchstates) {
+    decisions.emplace_back(state.desc->productID(), state.selectMe);
+    if (state.selectMe) {
+      selectedNames_.push_back(state.desc->branchName());
+    }
+  }
+  sort_all(decisions);
+  productIDs_.reserve(decisions.size());
+  selected_.reserve(decisions.size());
+  for (auto const& [pid, selectMe] : decisions) {
+    productIDs_.push_back(pid);
+    selected_.push_back(selectMe);
+  }
+}
+
+std::size_t
+GroupSelector::nslots() const noexcept
+{
+  return productIDs_.size();
+}
+
+std::size_t
+GroupSelector::slot(ProductID const pid) const
+{
+  auto const it = lower_bound(cbegin(productIDs_), cend(productIDs_), pid);
+  if (it == cend(productIDs_) || *it != pid) {
+    return invalid_slot;
+  }
+  return static_cast<std::size_t>(it - cbegin(productIDs_));
+}
+
+bool
+GroupSelector::selected(ProductID const pid) const
+{
+  auto const s = slot(pid);
+  return s != invalid_slot && selected_[s];
 }
 
 bool
 GroupSelector::selected(BranchDescription const& desc) const
 {
-  return binary_search_all(groupsToSelect_, &desc);
+  return selected(desc.productID());
 }
 
 void
 GroupSelector::print(ostream& os) const
 {
   os << "GroupSelector at: " << static_cast<void const*>(this) << " has "
-     << groupsToSelect_.size() << " groups to select:\n";
-  for (auto const& bd_ptr : groupsToSelect_) {
-    os << bd_ptr->branchName() << '\n';
+     << selectedNames_.size() << " groups to select:\n";
+  for (auto const& name : selectedNames_) {
+    os << name << '\n';
   }
 }
 
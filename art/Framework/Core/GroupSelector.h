@@ -8,8 +8,11 @@
 // ======================================================================
 
 #include "canvas/Persistency/Provenance/BranchDescription.h"
+#include "canvas/Persistency/Provenance/ProductID.h"
 
+#include <cstddef>
 #include <iosfwd>
+#include <string>
 #include <vector>
 
 namespace art {
@@ -29,14 +32,39 @@ public:
   explicit GroupSelector(GroupSelectorRules const& rules,
                          ProductDescriptionsByID const& descriptions);
 
+  // These search for the product's slot; clients that visit many
+  // products in ProductID order should use the slots below instead.
   bool selected(BranchDescription const& desc) const;
+  bool selected(ProductID pid) const;
+
+  // Each product known to the selector occupies one slot, in the
+  // (ProductID) order of the descriptions the selector was created
+  // with.  Since a principal holds its groups in the same order,
+  // clients that walk a principal can advance through the slots in
+  // step with it rather than looking each product up.
+  static constexpr std::size_t invalid_slot{static_cast<std::size_t>(-1)};
+  std::size_t nslots() const noexcept;
+  std::size_t slot(ProductID pid) const;
+  ProductID
+  productID(std::size_t const slot) const
+  {
+    return productIDs_[slot];
+  }
+  bool
+  selected(std::size_t const slot) const
+  {
+    return selected_[slot];
+  }
 
   // Printout intended for debugging purposes.
   void print(std::ostream& os) const;
 
 private:
-  // Keep a sorted collection indicating which groups are to be selected.
-  std::vector<BranchDescription const*> groupsToSelect_{};
+  // All known products, sorted by ProductID, and a dense bitmap
+  // indicating which of them are to be selected.
+  std::vector<ProductID> productIDs_{};
+  std::vector<bool> selected_{};
+  std::vector<std::string> selectedNames_{};
 
 }; // GroupSelector
 
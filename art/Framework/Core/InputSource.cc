@@ -1,6 +1,9 @@
 #include "art/Framework/Core/InputSource.h"
 // vim: set sw=2 expandtab :
 
+#include "art/Framework/Principal/EventPrincipal.h"
+#include "art/Framework/Principal/SubRunPrincipal.h"
+
 namespace art {
 
   InputSource::~InputSource() = default;
@@ -50,6 +53,18 @@ namespace art {
          "RootInput)\n";
   }
 
+  input::ItemType
+  InputSource::skipSubRun(cet::exempt_ptr<RunPrincipal const> const rp)
+  {
+    auto const srp = readSubRun(rp);
+    auto itemType = nextItemType();
+    while (itemType == input::IsEvent) {
+      readEvent(srp.get());
+      itemType = nextItemType();
+    }
+    return itemType;
+  }
+
   void
   InputSource::doBeginJob()
   {}
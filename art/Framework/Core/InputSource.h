@@ -99,6 +99,13 @@ namespace art {
     // function; the default implementation will throw an exception.
     virtual void skipEvents(int n);
 
+    // Skip the subrun just announced by nextItemType(), together with
+    // its events, and return the type of the item that follows them.
+    // The default implementation reads the subrun and its events and
+    // discards them; sources that can advance past them without reading
+    // them should override it.
+    virtual input::ItemType skipSubRun(cet::exempt_ptr<RunPrincipal const> rp);
+
     ModuleDescription const& moduleDescription() const;
     ProcessConfiguration const& processConfiguration() const;
 
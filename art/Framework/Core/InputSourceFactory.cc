@@ -2,11 +2,11 @@
 // vim: set sw=2 expandtab :
 
 #include "art/Framework/Core/InputSource.h"
+#include "art/Utilities/PluginIndex.h"
 #include "art/Utilities/PluginSuffixes.h"
 #include "art/Version/GetReleaseVersion.h"
 #include "canvas/Utilities/DebugMacros.h"
 #include "canvas/Utilities/Exception.h"
-#include "cetlib/LibraryManager.h"
 #include "cetlib/detail/wrapLibraryManagerException.h"
 #include "fhiclcpp/ParameterSet.h"
 
@@ -24,8 +24,8 @@ namespace art::InputSourceFactory {
                                                 InputSourceDescription&);
     make_t* symbol = nullptr;
     try {
-      cet::LibraryManager lm_{Suffixes::source()};
-      lm_.getSymbolByLibspec(libspec, "make", symbol);
+      PluginIndex const index{Suffixes::source()};
+      index.getSymbolByLibspec(libspec, "make", symbol);
     }
     catch (Exception const& e) {
       cet::detail::wrapLibraryManagerException(
@@ -0,0 +1,117 @@
+#ifndef art_Framework_Core_OutputByteCounts_h
+#define art_Framework_Core_OutputByteCounts_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// OutputByteCounts
+//
+// Running totals, by branch type, of the bytes an output module has
+// written to its current output file: the number of bytes serialized,
+// the number of bytes they were compressed to, and the number of
+// entries (events, subruns, ...) written.
+//
+// The totals are atomic, so they may be updated by the module as it
+// writes and read at any time (e.g. by ClosingCriteria when deciding
+// whether the file should be closed) without taking the output lock.
+// ======================================================================
+
+#include "canvas/Persistency/Provenance/BranchType.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace art {
+
+  class OutputByteCounts {
+  public:
+    void
+    record(BranchType const bt,
+           std::uint64_t const serialized,
+           std::uint64_t const compressed) noexcept
+    {
+      auto& c = counts_[bt];
+      c.serialized.fetch_add(serialized, std::memory_order_relaxed);
+      c.compressed.fetch_add(compressed, std::memory_order_relaxed);
+    }
+
+    void
+    recordEntry(BranchType const bt) noexcept
+    {
+      counts_[bt].entries.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void
+    reset() noexcept
+    {
+      for (auto& c : counts_) {
+        c.serialized = 0;
+        c.compressed = 0;
+        c.entries = 0;
+      }
+    }
+
+    std::uint64_t
+    serialized(BranchType const bt) const noexcept
+    {
+      return counts_[bt].serialized.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t
+    compressed(BranchType const bt) const noexcept
+    {
+      return counts_[bt].compressed.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t
+    entries(BranchType const bt) const noexcept
+    {
+      return counts_[bt].entries.load(std::memory_order_relaxed);
+    }
+
+    // Summed over all branch types.
+    std::uint64_t
+    serialized() const noexcept
+    {
+      std::uint64_t result{};
+      for (auto const& c : counts_) {
+        result += c.serialized.load(std::memory_order_relaxed);
+      }
+      return result;
+    }
+
+    std::uint64_t
+    compressed() const noexcept
+    {
+      std::uint64_t result{};
+      for (auto const& c : counts_) {
+        result += c.compressed.load(std::memory_order_relaxed);
+      }
+      return result;
+    }
+
+    // The mean number of compressed bytes per entry; 0 if no entries
+    // have been written.
+    double
+    meanCompressed(BranchType const bt) const noexcept
+    {
+      auto const n = entries(bt);
+      return n == 0 ? 0. : static_cast<double>(compressed(bt)) / n;
+    }
+
+  private:
+    struct Counts {
+      std::atomic<std::uint64_t> serialized{};
+      std::atomic<std::uint64_t> compressed{};
+      std::atomic<std::uint64_t> entries{};
+    };
+    std::array<Counts, NumBranchTypes> counts_{};
+  };
+
+} // namespace art
+
+#endif /* art_Framework_Core_OutputByteCounts_h */
+
+// Local Variables:
+// mode: c++
+// End:
@@ -35,13 +35,14 @@
 #include "fhiclcpp/ParameterSet.h"
 #include "range/v3/view.hpp"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <memory>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -130,14 +131,21 @@ namespace art {
       auto const& productList = tables.descriptions(bt);
       groupSelector_[bt] =
         std::make_unique<GroupSelector const>(groupSelectorRules_, productList);
+      auto const& selector = *groupSelector_[bt];
       // TODO: See if we can collapse keptProducts_ and groupSelector into
       // a single object. See the notes in the header for GroupSelector
       // for more information.
+      //
+      // The selector has one slot per product, in the (ProductID) order
+      // of productList, so the slots are taken in step with the list.
+      std::size_t slot{};
       for (auto const& pd : productList | ::ranges::views::values) {
+        auto const this_slot = slot++;
+        assert(selector.productID(this_slot) == pd.productID());
         if (pd.transient() || pd.dropped()) {
           continue;
         }
-        if (selected(pd)) {
+        if (selector.selected(this_slot)) {
           // Here, we take care to merge the BranchDescription objects
           // if one was already present in the keptProducts list.
           auto& keptProducts = keptProducts_[bt];
@@ -232,6 +240,7 @@ namespace art {
     auto const e = std::as_const(ep).makeEvent(mc);
     if (wantEvent(mc.scheduleID(), e)) {
       write(ep);
+      bytesWritten_.recordEntry(InEvent);
       // Declare that the event was selected for write to the catalog interface.
       Handle<TriggerResults> trHandle{getTriggerResults(e)};
       auto const& trRef(trHandle.isValid() ?
@@ -266,6 +275,7 @@ namespace art {
   {
     FDEBUG(2) << "writeSubRun called\n";
     writeSubRun(srp);
+    bytesWritten_.recordEntry(InSubRun);
   }
 
   void
@@ -290,6 +300,7 @@ namespace art {
   {
     FDEBUG(2) << "writeRun called\n";
     writeRun(rp);
+    bytesWritten_.recordEntry(InRun);
   }
 
   void
@@ -305,6 +316,7 @@ namespace art {
     if (isFileOpen()) {
       return false;
     }
+    bytesWritten_.reset();
     openFile(fb);
     return true;
   }
@@ -373,8 +385,7 @@ namespace art {
     branchChildren_.clear();
   }
 
-  // Called every event (by doWriteEvent) toupdate branchParents_
-  // and branchChildren_.
+  // Called every event (by doWriteEvent) to update branchParents_.
   void
   OutputModule::updateBranchParents(EventPrincipal& ep)
   {
@@ -387,29 +398,77 @@ namespace art {
     //       are running when we run. So since we are only called for
     //       event principals we are safe.
     //
-    // Note: threading: We update branchParents_ and branchChildren_
-    //       here which must be protected if we become a stream or
-    //       global module.
+    // Note: threading: We update branchParents_ here which must be
+    //       protected if we become a stream or global module.
     //
+    // Products not selected for output are skipped.  The principal's
+    // groups, the selector's slots, and branchParents_ are all ordered
+    // by ProductID, so each is advanced in step with the groups
+    // instead of being searched.  Products unknown to the selector
+    // are recorded.
+    assert(groupSelector_[InEvent]);
+    auto const& selector = *groupSelector_[InEvent];
+    auto const nslots = selector.nslots();
+    std::size_t slot{};
+    auto bp = begin(branchParents_);
+    auto const bp_end = end(branchParents_);
+    std::vector<BranchParents> newBranches;
     for (auto const& [pid, group] : ep) {
-      if (auto provenance = group->productProvenance()) {
-        auto iter = branchParents_.find(pid);
-        if (iter == branchParents_.end()) {
-          iter = branchParents_.emplace(pid, set<ParentageID>{}).first;
-        }
-        iter->second.insert(provenance->parentageID());
-        branchChildren_.insertEmpty(pid);
+      while (slot != nslots && selector.productID(slot) < pid) {
+        ++slot;
+      }
+      if (slot != nslots && selector.productID(slot) == pid &&
+          !selector.selected(slot)) {
+        continue;
+      }
+      auto provenance = group->productProvenance();
+      if (!provenance) {
+        continue;
+      }
+      auto const& parentageID = provenance->parentageID();
+      while (bp != bp_end && bp->pid < pid) {
+        ++bp;
+      }
+      if (bp == bp_end || bp->pid != pid) {
+        newBranches.push_back(BranchParents{pid, parentageID, {parentageID}});
+        continue;
+      }
+      // The common case: the same parentage as the last written event.
+      if (bp->last == parentageID) {
+        continue;
+      }
+      bp->last = parentageID;
+      if (std::find(cbegin(bp->parentageIDs),
+                    cend(bp->parentageIDs),
+                    parentageID) == cend(bp->parentageIDs)) {
+        bp->parentageIDs.push_back(parentageID);
       }
     }
-  }
-
-  // Called at file close to update branchChildren_ from the accumulated
+    if (newBranches.empty()) {
+      return;
+    }
+    // The new branches are already ordered by ProductID.
+    auto const n = branchParents_.size();
+    branchParents_.insert(end(branchParents_),
+                          make_move_iterator(begin(newBranches)),
+                          make_move_iterator(end(newBranches)));
+    std::inplace_merge(begin(branchParents_),
+                       begin(branchParents_) + n,
+                       end(branchParents_),
+                       [](auto const& a, auto const& b) {
+                         return a.pid < b.pid;
+                       });
+  }
+
+  // Called at file close to fill branchChildren_ from the accumulated
   // branchParents_.
   void
   OutputModule::fillDependencyGraph()
   {
-    for (auto const& [child, eIds] : branchParents_) {
-      for (auto const& eId : eIds) {
+    for (auto const& bp : branchParents_) {
+      auto const& child = bp.pid;
+      branchChildren_.insertEmpty(child);
+      for (auto const& eId : bp.parentageIDs) {
         Parentage par;
         if (!ParentageRegistry::get(eId, par)) {
           continue;
@@ -662,4 +721,18 @@ namespace art {
     return branchChildren_;
   }
 
+  OutputByteCounts const&
+  OutputModule::bytesWritten() const
+  {
+    return bytesWritten_;
+  }
+
+  void
+  OutputModule::recordBytesWritten(BranchType const bt,
+                                   std::uint64_t const serialized,
+                                   std::uint64_t const compressed)
+  {
+    bytesWritten_.record(bt, serialized, compressed);
+  }
+
 } // namespace art
@@ -11,6 +11,7 @@
 #include "art/Framework/Core/GroupSelectorRules.h"
 #include "art/Framework/Core/ModuleMacros.h"
 #include "art/Framework/Core/Observer.h"
+#include "art/Framework/Core/OutputByteCounts.h"
 #include "art/Framework/Core/OutputModuleDescription.h"
 #include "art/Framework/Core/OutputWorker.h"
 #include "art/Framework/Core/detail/SharedModule.h"
@@ -37,6 +38,7 @@
 #include <array>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
@@ -80,7 +82,11 @@ namespace art {
           R"(The "fileName" parameter is a pattern used to form the name of the output file.
 The ROOT output module supports the placeholders described at:
 
-  https://cdcvs.fnal.gov/redmine/projects/art_root_io/wiki/Output_file_renaming_for_ROOT_files)"),
+  https://cdcvs.fnal.gov/redmine/projects/art_root_io/wiki/Output_file_renaming_for_ROOT_files
+
+When the job is divided among several worker processes (--nprocesses),
+the pattern must also contain "%w", which is replaced by the index of
+the worker process.)"),
         ""};
       fhicl::Atom<std::string> dataTier{fhicl::Name("dataTier"), ""};
       fhicl::Atom<std::string> streamName{fhicl::Name("streamName"), ""};
@@ -117,11 +123,20 @@ The ROOT output module supports the placeholders described at:
     void doSelectProducts(ProductTables const&);
     void registerProducts(ProductDescriptions&);
     BranchChildren const& branchChildren() const;
+    // The bytes written to the current output file, as reported by
+    // recordBytesWritten.  The totals are reset when a file is opened.
+    OutputByteCounts const& bytesWritten() const;
 
   protected:
     // Called to register products if necessary.
     virtual void doRegisterProducts(ProductDescriptions&,
                                     ModuleDescription const&);
+    // To be called by the output module whenever it has written data
+    // for the given branch type, so that ClosingCriteria and other
+    // observers can follow the size of the file without querying it.
+    void recordBytesWritten(BranchType bt,
+                            std::uint64_t serialized,
+                            std::uint64_t compressed);
 
   private:
     std::unique_ptr<Worker> doMakeWorker(WorkerParams const& wp) final;
@@ -228,9 +243,18 @@ The ROOT output module supports the placeholders described at:
       groupSelector_{{nullptr}};
     std::array<bool, NumBranchTypes> hasNewlyDroppedBranch_{{false}};
     GroupSelectorRules groupSelectorRules_;
-    using BranchParents = std::map<ProductID, std::set<ParentageID>>;
-    std::map<ProductID, std::set<ParentageID>> branchParents_{};
+    // The distinct parentages of each written product, ordered by
+    // ProductID.  Consecutive events almost always carry the same
+    // parentage for a given product, so the last one seen is checked
+    // before the (short) list of all of them.
+    struct BranchParents {
+      ProductID pid;
+      ParentageID last;
+      std::vector<ParentageID> parentageIDs;
+    };
+    std::vector<BranchParents> branchParents_{};
     BranchChildren branchChildren_{};
+    OutputByteCounts bytesWritten_{};
     std::string configuredFileName_;
     std::string dataTier_;
     std::string streamName_;
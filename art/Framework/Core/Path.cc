@@ -9,7 +9,6 @@
 #include "art/Framework/Services/Registry/ServiceHandle.h"
 #include "art/Framework/Services/System/TriggerNamesService.h"
 #include "art/Utilities/GlobalTaskGroup.h"
-#include "art/Utilities/Globals.h"
 #include "art/Utilities/ScheduleID.h"
 #include "art/Utilities/TaskDebugMacros.h"
 #include "art/Utilities/Transition.h"
@@ -108,79 +107,170 @@ namespace art {
   }
 
   void
-  Path::process(Transition const trans, Principal& principal)
+  Path::process(WaitingTaskPtr pathsDoneTask,
+                Transition const trans,
+                Principal& principal)
   {
-    // Invoke pre-path signals only for the first schedule.
-    if (pc_.scheduleID() == ScheduleID::first()) {
-      switch (trans) {
-      case Transition::BeginRun:
-        actReg_.sPrePathBeginRun.invoke(name());
-        break;
-      case Transition::EndRun:
-        actReg_.sPrePathEndRun.invoke(name());
-        break;
-      case Transition::BeginSubRun:
-        actReg_.sPrePathBeginSubRun.invoke(name());
-        break;
-      case Transition::EndSubRun:
-        actReg_.sPrePathEndSubRun.invoke(name());
-        break;
-      default: {
-      } // No other pre-path signals supported.
-      }
-    }
+    auto const sid = pc_.scheduleID();
+    TDEBUG_BEGIN_FUNC_SI(4, sid);
     state_ = hlt::Ready;
-    std::size_t idx = 0;
-    bool all_passed{false};
-    for (WorkerInPath& wip : workers_) {
-      // We do not want to call (e.g.) beginRun once per schedule for
-      // non-replicated modules.
-      if (not wip.getWorker()->isUnique()) {
-        continue;
-      }
+    transitionIdx_ = 0;
+    // Start the task spawn chain going with the first worker on the
+    // path, exactly as is done for events.
+    process_transition_idx_asynch(0, trans, principal, pathsDoneTask);
+    TDEBUG_END_FUNC_SI(4, sid);
+  }
+
+  void
+  Path::process_transition_idx_asynch(size_t const idx,
+                                      Transition const trans,
+                                      Principal& principal,
+                                      WaitingTaskPtr pathsDone)
+  {
+    taskGroup_.run([this, idx, trans, &principal, pathsDone] {
+      auto const sid = pc_.scheduleID();
+      TDEBUG_BEGIN_TASK_SI(4, sid);
       try {
-        all_passed = wip.run(trans, principal);
-        if (!all_passed)
-          break;
-      }
-      catch (cet::exception& e) {
-        state_ = hlt::Exception;
-        throw Exception{
-          errors::ScheduleExecutionFailure, "Path: ProcessingStopped.", e}
-          << "Exception going through path " << name() << '\n';
+        process_transition_idx(idx, trans, principal, pathsDone);
+        TDEBUG_END_TASK_SI(4, sid);
       }
       catch (...) {
-        mf::LogError("PassingThrough")
-          << "Exception passing through path " << name();
-        state_ = hlt::Exception;
-        throw;
+        taskGroup_.may_run(pathsDone, current_exception());
+        TDEBUG_END_TASK_SI(4, sid) << "path terminate because of EXCEPTION";
+      }
+    });
+  }
+
+  class Path::TransitionWorkerDoneTask {
+  public:
+    TransitionWorkerDoneTask(Path* path,
+                             size_t const idx,
+                             Transition const trans,
+                             Principal& principal,
+                             WaitingTaskPtr pathsDone,
+                             GlobalTaskGroup& group)
+      : path_{path}
+      , idx_{idx}
+      , trans_{trans}
+      , principal_{principal}
+      , pathsDone_{pathsDone}
+      , group_{group}
+    {}
+    void
+    operator()(exception_ptr const ex)
+    {
+      auto const sid = path_->pc_.scheduleID();
+      TDEBUG_BEGIN_TASK_SI(4, sid);
+      if (ex) {
+        // Exceptions thrown during run and subrun transitions always
+        // end processing; the action table is not consulted.
+        path_->state_ = hlt::Exception;
+        try {
+          rethrow_exception(ex);
+        }
+        catch (cet::exception& e) {
+          auto art_ex =
+            Exception{
+              errors::ScheduleExecutionFailure, "Path: ProcessingStopped.", e}
+            << "Exception going through path " << path_->name() << '\n';
+          group_.may_run(pathsDone_, make_exception_ptr(art_ex));
+        }
+        catch (...) {
+          mf::LogError("PassingThrough")
+            << "Exception passing through path " << path_->name();
+          group_.may_run(pathsDone_, current_exception());
+        }
+        TDEBUG_END_TASK_SI(4, sid) << "terminate path because of EXCEPTION";
+        return;
       }
+      path_->process_transition_idx_asynch(
+        idx_ + 1, trans_, principal_, pathsDone_);
+      TDEBUG_END_TASK_SI(4, sid);
+    }
+
+  private:
+    Path* path_;
+    size_t const idx_;
+    Transition const trans_;
+    Principal& principal_;
+    WaitingTaskPtr pathsDone_;
+    GlobalTaskGroup& group_;
+  };
+
+  void
+  Path::process_transition_idx(size_t idx,
+                               Transition const trans,
+                               Principal& principal,
+                               WaitingTaskPtr pathsDone)
+  {
+    // We do not want to call (e.g.) beginRun once per schedule for
+    // non-replicated modules, or for replicated-module copies that
+    // several schedules share.
+    auto const max_idx = workers_.size();
+    while (idx < max_idx && !workers_[idx].getWorker()->isUnique()) {
       ++idx;
     }
-    if (all_passed) {
+    if (idx == max_idx) {
       state_ = hlt::Pass;
-    } else {
-      state_ = hlt::Fail;
+      taskGroup_.may_run(pathsDone);
+      return;
     }
-    // Invoke post-path signals only for the last schedule.
-    if (pc_.scheduleID().id() == Globals::instance()->nschedules() - 1) {
-      HLTPathStatus const status(state_, idx);
-      switch (trans) {
-      case Transition::BeginRun:
-        actReg_.sPostPathBeginRun.invoke(name(), status);
-        break;
-      case Transition::EndRun:
-        actReg_.sPostPathEndRun.invoke(name(), status);
-        break;
-      case Transition::BeginSubRun:
-        actReg_.sPostPathBeginSubRun.invoke(name(), status);
-        break;
-      case Transition::EndSubRun:
-        actReg_.sPostPathEndSubRun.invoke(name(), status);
-        break;
-      default: {
-      } // No other post-path signals supported.
-      }
+    transitionIdx_ = idx;
+    auto workerDoneTask = make_waiting_task<TransitionWorkerDoneTask>(
+      this, idx, trans, principal, pathsDone, taskGroup_);
+    workers_[idx].run(workerDoneTask, trans, principal);
+  }
+
+  // The paths of all schedules process a run or subrun transition
+  // concurrently, so its path signals are invoked by the
+  // EventProcessor, once per transition, before and after all
+  // schedules have processed it.  The schedule that invokes them runs
+  // every worker on its paths.  A path that does not get to run,
+  // because an exception stopped the transition first, is reported as
+  // not run.
+  void
+  Path::invokePreTransitionSignal(Transition const trans)
+  {
+    state_ = hlt::Ready;
+    transitionIdx_ = 0;
+    switch (trans) {
+    case Transition::BeginRun:
+      actReg_.sPrePathBeginRun.invoke(name());
+      break;
+    case Transition::EndRun:
+      actReg_.sPrePathEndRun.invoke(name());
+      break;
+    case Transition::BeginSubRun:
+      actReg_.sPrePathBeginSubRun.invoke(name());
+      break;
+    case Transition::EndSubRun:
+      actReg_.sPrePathEndSubRun.invoke(name());
+      break;
+    default: {
+    } // No other pre-path signals supported.
+    }
+  }
+
+  void
+  Path::invokePostTransitionSignal(Transition const trans) const
+  {
+    // The index is that of the last worker run by the path.
+    HLTPathStatus const status(state_, transitionIdx_);
+    switch (trans) {
+    case Transition::BeginRun:
+      actReg_.sPostPathBeginRun.invoke(name(), status);
+      break;
+    case Transition::EndRun:
+      actReg_.sPostPathEndRun.invoke(name(), status);
+      break;
+    case Transition::BeginSubRun:
+      actReg_.sPostPathBeginSubRun.invoke(name(), status);
+      break;
+    case Transition::EndSubRun:
+      actReg_.sPostPathEndSubRun.invoke(name(), status);
+      break;
+    default: {
+    } // No other post-path signals supported.
     }
   }
 
@@ -49,12 +49,27 @@ namespace art {
     std::size_t timesExcept() const;
     // Note: threading: Clears the counters of workersInPath.
     void clearCounters();
-    void process(Transition, Principal&);
+    void process(hep::concurrency::WaitingTaskPtr pathsDoneTask,
+                 Transition,
+                 Principal&);
+    void invokePreTransitionSignal(Transition);
+    void invokePostTransitionSignal(Transition) const;
     void process(hep::concurrency::WaitingTaskPtr pathsDoneTask,
                  EventPrincipal&);
 
   private:
     class WorkerDoneTask;
+    class TransitionWorkerDoneTask;
+
+    void process_transition_idx_asynch(
+      size_t idx,
+      Transition,
+      Principal&,
+      hep::concurrency::WaitingTaskPtr pathsDone);
+    void process_transition_idx(size_t idx,
+                                Transition,
+                                Principal&,
+                                hep::concurrency::WaitingTaskPtr pathsDone);
 
     void runWorkerTask(size_t idx,
                        size_t max_idx,
@@ -93,6 +108,7 @@ namespace art {
 
     // These are adjusted in a serialized context.
     hlt::HLTState state_{hlt::Ready};
+    std::size_t transitionIdx_{};
     std::size_t timesRun_{};
     std::size_t timesPassed_{};
     std::size_t timesFailed_{};
@@ -26,7 +26,6 @@
 #include "art/Version/GetReleaseVersion.h"
 #include "canvas/Utilities/Exception.h"
 #include "cetlib/HorizontalRule.h"
-#include "cetlib/LibraryManager.h"
 #include "cetlib/bold_fontify.h"
 #include "cetlib/container_algorithms.h"
 #include "cetlib/detail/wrapLibraryManagerException.h"
@@ -34,6 +33,8 @@
 #include "fhiclcpp/ParameterSet.h"
 #include "fhiclcpp/ParameterSetRegistry.h"
 #include "fhiclcpp/types/detail/validationException.h"
+#include "hep_concurrency/SerialTaskQueue.h"
+#include "hep_concurrency/SerialTaskQueueChain.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 #include "range/v3/action.hpp"
 #include "range/v3/view.hpp"
@@ -66,6 +67,31 @@ namespace art {
       return wcis | views::transform(to_label) | to<std::vector>() |
              ::ranges::actions::sort;
     }
+
+    // Schedule i uses copy i % nreplicas of a replicated module.  The
+    // copy is made in the task arena used by the largest number of the
+    // schedules that share it; returns the first schedule in that arena.
+    ScheduleID
+    placement_schedule(ScheduleID const copy_id,
+                       ScheduleID::size_type const nreplicas,
+                       GlobalTaskGroup const& task_group)
+    {
+      auto const nschedules = Globals::instance()->nschedules();
+      std::vector<ScheduleID::size_type> counts(task_group.n_arenas());
+      if (counts.size() < 2) {
+        return copy_id;
+      }
+      auto result = copy_id;
+      for (auto i = copy_id.id(); i < nschedules; i += nreplicas) {
+        ScheduleID const sid{i};
+        auto const arena = task_group.arena_index(sid);
+        ++counts[arena];
+        if (counts[arena] > counts[task_group.arena_index(result)]) {
+          result = sid;
+        }
+      }
+      return result;
+    }
   } // anonymous namespace
 
   PathManager::PathManager(ParameterSet const& procPS,
@@ -180,7 +206,7 @@ namespace art {
     // The modules created are managed by shared_ptrs.  Once the
     // workers claim (co-)ownership of the modules, the 'modules'
     // object can be destroyed.
-    modules_ = makeModules_(nschedules);
+    modules_ = makeModules_(Globals::instance()->nreplicas(), task_group);
 
     // FIXME: THE PATHS INFO OBJECTS SHOULD BECOME OWNERS OF THE WORKERS
     //        I IMAGINE AN API LIKE:
@@ -267,6 +293,7 @@ namespace art {
     protoTrigPathLabels_.clear();
     protoEndPathLabels_.clear();
     allModules_.clear();
+    replicaQueues_.clear();
   }
 
   PathsInfo&
@@ -339,7 +366,8 @@ namespace art {
   }
 
   PathManager::ModulesByThreadingType
-  PathManager::makeModules_(ScheduleID::size_type const nschedules)
+  PathManager::makeModules_(ScheduleID::size_type const nreplicas,
+                            GlobalTaskGroup& task_group)
   {
     ModulesByThreadingType modules{};
     vector<string> configErrMsgs;
@@ -352,8 +380,20 @@ namespace art {
       // FIXME: provide context information?
       actReg_.sPreModuleConstruction.invoke(md);
 
+      // Each copy of a replicated module is made in the task arena of
+      // the schedules that use it (if NUMA placement is enabled), so
+      // that the memory it allocates on construction is on their node.
+      auto make_module = [&, this](ScheduleID const sid) {
+        if (module_threading_type != ModuleThreadingType::replicated) {
+          return makeModule_(modPS, md, sid);
+        }
+        return task_group.execute(
+          placement_schedule(sid, nreplicas, task_group),
+          [&, this, sid] { return makeModule_(modPS, md, sid); });
+      };
+
       auto sid = ScheduleID::first();
-      auto mod = makeModule_(modPS, md, sid);
+      auto mod = make_module(sid);
       if (auto err_msg = get_if<std::string>(&mod)) {
         configErrMsgs.push_back(*err_msg);
         continue;
@@ -368,13 +408,13 @@ namespace art {
                                std::unique_ptr<ModuleBase>{module});
       } else {
         PerScheduleContainer<std::unique_ptr<ModuleBase>> replicated_modules(
-          nschedules);
+          nreplicas);
         replicated_modules[sid].reset(module);
         ScheduleIteration schedule_iteration{sid.next(),
-                                             ScheduleID(nschedules)};
+                                             ScheduleID(nreplicas)};
 
         auto fill_replicated_module = [&, this](ScheduleID const sid) {
-          auto repl_mod = makeModule_(modPS, md, sid);
+          auto repl_mod = make_module(sid);
           if (auto mod_ptr = get_if<ModuleBase*>(&repl_mod)) {
             replicated_modules[sid].reset(*mod_ptr);
           }
@@ -518,23 +558,40 @@ namespace art {
     return wips;
   }
 
+  // Schedule i uses copy i % nreplicas of a replicated module.  When
+  // there are fewer copies than schedules, the work of each copy is
+  // serialized on a queue of its own, which its workers share.  Each
+  // schedule still has its own worker, so the copy's event calls are
+  // given the ProcessingFrame of the event's schedule; only its
+  // construction and the calls made once per copy (job, file, run and
+  // subrun) see the schedule whose ID the copy bears.
   std::shared_ptr<Worker>
   PathManager::makeWorker_(ModuleDescription const& md, WorkerParams const& wp)
   {
-    auto get_module = [this](std::string const& module_label,
-                             ModuleThreadingType const module_threading_type,
-                             ScheduleID const sid) -> auto&
-    {
-      if (module_threading_type == ModuleThreadingType::shared ||
-          module_threading_type == ModuleThreadingType::legacy) {
-        return modules_.shared.at(module_label);
-      }
-      return modules_.replicated.at(module_label)[sid];
-    };
+    auto const& module_label = md.moduleLabel();
+    auto const module_threading_type = md.moduleThreadingType();
+    if (module_threading_type == ModuleThreadingType::shared ||
+        module_threading_type == ModuleThreadingType::legacy) {
+      return modules_.shared.at(module_label)->makeWorker(wp);
+    }
 
-    auto& module =
-      get_module(md.moduleLabel(), md.moduleThreadingType(), wp.scheduleID_);
-    return module->makeWorker(wp);
+    auto const& copies = modules_.replicated.at(module_label);
+    auto const sid = wp.scheduleID_;
+    ScheduleID const copy_id{
+      static_cast<ScheduleID::size_type>(sid.id() % copies.size())};
+    std::shared_ptr<Worker> worker{copies[copy_id]->makeWorker(wp)};
+    if (copies.size() < Globals::instance()->nschedules()) {
+      auto& queues = replicaQueues_[module_label];
+      queues.resize(copies.size());
+      auto& queue = queues[copy_id.id()];
+      if (!queue) {
+        using namespace hep::concurrency;
+        queue = std::make_shared<SerialTaskQueueChain>(
+          std::vector{std::make_shared<SerialTaskQueue>(wp.taskGroup_)});
+      }
+      worker->shareReplica(queue, copy_id == sid);
+    }
+    return worker;
   }
 
   ModuleType
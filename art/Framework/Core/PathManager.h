@@ -23,10 +23,10 @@
 #include "art/Framework/Core/detail/graph_type_aliases.h"
 #include "art/Persistency/Provenance/ModuleType.h"
 #include "art/Utilities/PerScheduleContainer.h"
+#include "art/Utilities/PluginIndex.h"
 #include "art/Utilities/PluginSuffixes.h"
 #include "art/Utilities/ScheduleID.h"
 #include "canvas/Persistency/Provenance/BranchDescription.h"
-#include "cetlib/LibraryManager.h"
 #include "fhiclcpp/ParameterSet.h"
 
 #include <map>
@@ -36,6 +36,10 @@
 #include <variant>
 #include <vector>
 
+namespace hep::concurrency {
+  class SerialTaskQueueChain;
+}
+
 namespace art {
 
   class ActionTable;
@@ -84,7 +88,8 @@ namespace art {
     std::map<std::string, detail::ModuleConfigInfo> moduleInformation_(
       detail::EnabledModules const& enabled_modules) const;
 
-    ModulesByThreadingType makeModules_(ScheduleID::size_type n);
+    ModulesByThreadingType makeModules_(ScheduleID::size_type nreplicas,
+                                        GlobalTaskGroup& task_group);
     std::unique_ptr<ReplicatedProducer> makeTriggerResultsInserter_(
       ScheduleID scheduleID);
 
@@ -129,7 +134,7 @@ namespace art {
     PerScheduleContainer<PathsInfo> endPathInfo_;
     ProductDescriptions& productsToProduce_;
 
-    cet::LibraryManager lm_{Suffixes::module()};
+    PluginIndex lm_{Suffixes::module()};
     //  The following data members are only needed to delay the
     //  creation of modules until after the service system has
     //  started.  We can move them back to the ctor once that is
@@ -139,6 +144,10 @@ namespace art {
     art::detail::paths_to_modules_t protoTrigPathLabels_{};
     art::detail::configs_t protoEndPathLabels_{};
     ModulesByThreadingType modules_{};
+    std::map<module_label_t,
+             std::vector<
+               std::shared_ptr<hep::concurrency::SerialTaskQueueChain>>>
+      replicaQueues_{};
     PerScheduleContainer<std::unique_ptr<Worker>> triggerResultsWorkers_;
   };
 } // namespace art
@@ -55,7 +55,7 @@ namespace art {
   {
     auto e = ep.makeEvent(mc_);
     postReadEvent(e);
-    e.commitProducts(true, &expectedProducts<InEvent>());
+    e.commitProducts(true, &expectedProducts<InEvent>(), parentageCache_);
   }
 
   void
@@ -3,6 +3,7 @@
 // vim: set sw=2 expandtab :
 
 #include "art/Framework/Core/ProductRegistryHelper.h"
+#include "art/Framework/Principal/ParentageCache.h"
 #include "art/Framework/Principal/fwd.h"
 #include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
 #include "art/Framework/Services/Registry/ServiceDefinitionMacros.h"
@@ -41,6 +42,7 @@ namespace art {
     // which contains the service_type as the module label.  We must
     // copy it because it has no permanent existence.
     ModuleContext mc_{ModuleContext::invalid()};
+    ParentageCache parentageCache_{};
   };
 
 } // namespace art
@@ -169,6 +169,23 @@
 //     straightforward client code -- this one is provided for maximum
 //     flexibility.
 //
+// 15. Remap and flatten a set of collections of Ptr (including
+// PtrVector) into a std::vector of Ptr, in parallel:
+//
+//       std::vector<Ptr<A>> out;
+//       remap.inParallel(in, out, offsets);
+//
+//     The output is resized once to its final size, after which the
+//     Ptrs are remapped and written into place concurrently (using
+//     TBB).  As for 4., offsets is likely calculated by the
+//     appropriate call to art::flattenCollections (or
+//     art::flattenCollectionsInParallel).
+//
+// For all signatures that remap a collection of Ptrs, the translation
+// of a Ptr's ProductID is looked up only when it differs from that of
+// the previous Ptr, so remapping a collection of Ptrs into the same
+// product costs one lookup rather than one per Ptr.
+//
 // -------------------------
 // art::ProductPtr remapping
 // -------------------------
@@ -210,7 +227,10 @@
 #include "canvas/Persistency/Provenance/ProductID.h"
 #include "cetlib/exempt_ptr.h"
 
+#include <cstddef>
+#include <iterator>
 #include <map>
+#include <vector>
 
 namespace art {
   class PtrRemapper;
@@ -356,6 +376,12 @@ public:
                   OFFSETS const& offsets,
                   CALLBACK extractor) const;
 
+  // 15.
+  template <typename PROD, typename T, typename OFFSETS>
+  void inParallel(std::vector<PROD const*> const& in,
+                  std::vector<Ptr<T>>& out,
+                  OFFSETS const& offsets) const;
+
   // ---------------------
   // ProductPtr remappings
   // ---------------------
@@ -386,6 +412,26 @@ private:
 
   RefCore newRefCore_(ProductID const incomingProductID) const;
 
+  // The translation of the most recently remapped ProductID.
+  struct RefCoreCache {
+    ProductID oldID{};
+    RefCore core{};
+  };
+
+  template <typename PROD, typename SIZE_TYPE>
+  Ptr<PROD> remap_(Ptr<PROD> const& oldPtr,
+                   SIZE_TYPE offset,
+                   RefCoreCache& cache) const;
+
+  template <typename PROD, typename SIZE_TYPE>
+  PtrVector<PROD>
+  remap_(PtrVector<PROD> const& old,
+         SIZE_TYPE const offset,
+         RefCoreCache&) const
+  {
+    return this->operator()(old, offset); // 2.
+  }
+
   template <typename PROD>
   static ProductPtr<PROD>
   samePtrAs(ProductPtr<PROD> result, ProductPtr<PROD> old)
@@ -421,17 +467,21 @@ private:
 // art::Ptr remappings
 // -------------------
 
-// 1.
 template <typename PROD, typename SIZE_TYPE>
 art::Ptr<PROD>
-art::PtrRemapper::operator()(Ptr<PROD> const& oldPtr,
-                             SIZE_TYPE const offset) const
+art::PtrRemapper::remap_(Ptr<PROD> const& oldPtr,
+                         SIZE_TYPE const offset,
+                         RefCoreCache& cache) const
 {
   if (!oldPtr.id().isValid() || oldPtr.isNull()) {
     return {};
   }
 
-  auto core = newRefCore_(oldPtr.id());
+  if (cache.oldID != oldPtr.id()) {
+    cache.core = newRefCore_(oldPtr.id());
+    cache.oldID = oldPtr.id();
+  }
+  auto const& core = cache.core;
   if (core.productGetter()) {
     return Ptr<PROD>{core.id(), oldPtr.key() + offset, core.productGetter()};
   }
@@ -439,6 +489,16 @@ art::PtrRemapper::operator()(Ptr<PROD> const& oldPtr,
   throw unknownProduct_<Ptr<PROD>>(core.id());
 }
 
+// 1.
+template <typename PROD, typename SIZE_TYPE>
+art::Ptr<PROD>
+art::PtrRemapper::operator()(Ptr<PROD> const& oldPtr,
+                             SIZE_TYPE const offset) const
+{
+  RefCoreCache cache;
+  return remap_(oldPtr, offset, cache);
+}
+
 // 2.
 template <typename PROD, typename SIZE_TYPE>
 art::PtrVector<PROD>
@@ -467,13 +527,15 @@ art::PtrRemapper::operator()(InIter const beg,
 
   // Not using transform here allows instantiation for iterator to
   // collection of Ptr or collection of PtrVector.
+  RefCoreCache cache;
   for (auto i = beg; i != end; ++i) {
-    // Note: this could be signature 1 OR 2 of operator(). If the user
-    // calls this signature (3) with iterators into a collection of
-    // PtrVector, then the call order will be 3, 2, 3, 1 due to the
-    // templates that will be instantiated i.e. the relationship
-    // between signatures 2 and 3 is *not* infinitely recursive.
-    *out++ = this->operator()(*i, offset); // 1 OR 2.
+    // Note: this remaps either a Ptr or (via signature 2) a
+    // PtrVector. If the user calls this signature (3) with iterators
+    // into a collection of PtrVector, then the call order will be 3,
+    // 2, 3 due to the templates that will be instantiated i.e. the
+    // relationship between signatures 2 and 3 is *not* infinitely
+    // recursive.
+    *out++ = remap_(*i, offset, cache);
   }
 }
 
@@ -590,6 +652,47 @@ art::PtrRemapper::operator()(std::vector<PROD const*> const& in,
   }
 }
 
+// 15.
+template <typename PROD, typename T, typename OFFSETS>
+void
+art::PtrRemapper::inParallel(std::vector<PROD const*> const& in,
+                             std::vector<Ptr<T>>& out,
+                             OFFSETS const& offsets) const
+{
+  if (in.size() != offsets.size()) {
+    throw Exception(errors::LogicError)
+      << "Collection size of " << in.size()
+      << " disagrees with offset container size of " << offsets.size() << ".\n";
+  }
+  std::vector<std::size_t> starts;
+  starts.reserve(in.size());
+  std::size_t total{};
+  for (auto const* prod : in) {
+    starts.push_back(total);
+    total += prod->size();
+  }
+  if (total == 0) {
+    return;
+  }
+  auto const base = out.size();
+  out.resize(base + total);
+  auto* const dest = out.data() + base;
+  std::vector<std::size_t> const key_offsets(offsets.begin(), offsets.end());
+  detail::parallel_for_segments(
+    starts,
+    total,
+    [this, &in, &key_offsets, dest](std::size_t const i,
+                                    std::size_t const b,
+                                    std::size_t const e,
+                                    std::size_t const d) {
+      RefCoreCache cache;
+      auto src = std::next(in[i]->begin(), b);
+      for (auto k = d, end = d + (e - b); k != end; ++k, ++src) {
+        dest[k] = remap_(*src, key_offsets[i], cache);
+      }
+    });
+}
+
 // --------------------------
 // art::ProductPtr remappings
 // --------------------------
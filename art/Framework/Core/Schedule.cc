@@ -2,12 +2,14 @@
 // vim: set sw=2 expandtab :
 
 #include "art/Framework/Services/Registry/ActivityRegistry.h"
+#include "art/Utilities/GlobalTaskGroup.h"
 #include "art/Persistency/Provenance/ModuleContext.h"
 #include "art/Utilities/ScheduleID.h"
 #include "art/Utilities/TaskDebugMacros.h"
 #include "art/Utilities/Transition.h"
 #include "hep_concurrency/WaitingTask.h"
 
+#include <exception>
 #include <ios>
 
 using namespace hep::concurrency;
@@ -23,6 +25,7 @@ namespace art {
                      GlobalTaskGroup& task_group)
     : context_{scheduleID}
     , actions_{actions}
+    , taskGroup_{task_group}
     , epExec_{scheduleID, pm, actions, outputCallbacks, task_group}
     , tpsExec_{scheduleID, pm, actions, actReg, task_group}
   {
@@ -71,11 +74,67 @@ namespace art {
     epExec_.respondToCloseOutputFiles(fb);
   }
 
+  class Schedule::TransitionEndPathTask {
+  public:
+    TransitionEndPathTask(EndPathExecutor& epExec,
+                          WaitingTaskPtr const transitionDoneTask,
+                          Transition const trans,
+                          Principal& principal,
+                          GlobalTaskGroup& group)
+      : epExec_{epExec}
+      , transitionDoneTask_{transitionDoneTask}
+      , trans_{trans}
+      , principal_{principal}
+      , taskGroup_{group}
+    {}
+
+    void
+    operator()(exception_ptr const ex)
+    {
+      if (ex) {
+        taskGroup_.may_run(transitionDoneTask_, ex);
+        return;
+      }
+      try {
+        epExec_.process(transitionDoneTask_, trans_, principal_);
+      }
+      catch (...) {
+        taskGroup_.may_run(transitionDoneTask_, current_exception());
+      }
+    }
+
+  private:
+    EndPathExecutor& epExec_;
+    WaitingTaskPtr const transitionDoneTask_;
+    Transition const trans_;
+    Principal& principal_;
+    GlobalTaskGroup& taskGroup_;
+  };
+
+  void
+  Schedule::process(WaitingTaskPtr transitionDoneTask,
+                    Transition const trans,
+                    Principal& principal)
+  {
+    // The end path runs only after all of the trigger paths have
+    // finished.
+    auto endPathTask = make_waiting_task<TransitionEndPathTask>(
+      epExec_, transitionDoneTask, trans, principal, taskGroup_);
+    tpsExec_.process(endPathTask, trans, principal);
+  }
+
+  void
+  Schedule::invokePrePathSignals(Transition const trans)
+  {
+    tpsExec_.invokePrePathSignals(trans);
+    epExec_.invokePrePathSignals(trans);
+  }
+
   void
-  Schedule::process(Transition const trans, Principal& principal)
+  Schedule::invokePostPathSignals(Transition const trans) const
   {
-    tpsExec_.process(trans, principal);
-    epExec_.process(trans, principal);
+    tpsExec_.invokePostPathSignals(trans);
+    epExec_.invokePostPathSignals(trans);
   }
 
   void
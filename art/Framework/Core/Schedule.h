@@ -45,7 +45,13 @@ namespace art {
     Schedule& operator=(Schedule&&) = delete;
 
     // API presented to EventProcessor
-    void process(Transition, Principal&);
+    void process(hep::concurrency::WaitingTaskPtr transitionDoneTask,
+                 Transition,
+                 Principal&);
+    // The path signals of a run or subrun transition, for the trigger
+    // paths in order and then the end path.
+    void invokePrePathSignals(Transition);
+    void invokePostPathSignals(Transition) const;
     void process_event_modifiers(hep::concurrency::WaitingTaskPtr endPathTask);
     void process_event_observers(
       hep::concurrency::WaitingTaskPtr finalizeEventTask);
@@ -191,8 +197,11 @@ namespace art {
     class EndPathRunnerTask;
 
   private:
+    class TransitionEndPathTask;
+
     ScheduleContext const context_;
     ActionTable const& actions_;
+    GlobalTaskGroup& taskGroup_;
     EndPathExecutor epExec_;
     TriggerPathsExecutor tpsExec_;
     std::unique_ptr<EventPrincipal> eventPrincipal_{nullptr};
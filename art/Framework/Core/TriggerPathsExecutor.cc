@@ -156,12 +156,68 @@ namespace art {
     }
   }
 
+  class TriggerPathsExecutor::TransitionPathsDoneTask {
+  public:
+    TransitionPathsDoneTask(WaitingTaskPtr const endPathTask,
+                            GlobalTaskGroup& group)
+      : endPathTask_{endPathTask}, taskGroup_{group}
+    {}
+
+    void
+    operator()(exception_ptr const ex)
+    {
+      taskGroup_.may_run(endPathTask_, ex);
+    }
+
+  private:
+    WaitingTaskPtr const endPathTask_;
+    GlobalTaskGroup& taskGroup_;
+  };
+
   void
-  TriggerPathsExecutor::process(Transition const trans, Principal& principal)
+  TriggerPathsExecutor::process(WaitingTaskPtr endPathTask,
+                                Transition const trans,
+                                Principal& principal)
   {
+    auto const scheduleID = sc_.id();
+    TDEBUG_BEGIN_FUNC_SI(4, scheduleID);
     triggerPathsInfo_.reset();
+    try {
+      auto& paths = triggerPathsInfo_.paths();
+      if (paths.empty()) {
+        taskGroup_.may_run(endPathTask);
+        TDEBUG_END_FUNC_SI(4, scheduleID);
+        return;
+      }
+      // The paths run concurrently, each one running its workers in
+      // the order specified on the path.  The end-path task is
+      // released once every path has finished.
+      auto pathsDoneTask = std::make_shared<WaitingTask>(
+        TransitionPathsDoneTask{endPathTask, taskGroup_}, paths.size());
+      for (auto& path : paths) {
+        path.process(pathsDoneTask, trans, principal);
+      }
+      TDEBUG_END_FUNC_SI(4, scheduleID);
+    }
+    catch (...) {
+      taskGroup_.may_run(endPathTask, current_exception());
+      TDEBUG_END_FUNC_SI(4, scheduleID) << "because of EXCEPTION";
+    }
+  }
+
+  void
+  TriggerPathsExecutor::invokePrePathSignals(Transition const trans)
+  {
     for (auto& path : triggerPathsInfo_.paths()) {
-      path.process(trans, principal);
+      path.invokePreTransitionSignal(trans);
+    }
+  }
+
+  void
+  TriggerPathsExecutor::invokePostPathSignals(Transition const trans) const
+  {
+    for (auto const& path : triggerPathsInfo_.paths()) {
+      path.invokePostTransitionSignal(trans);
     }
   }
 
@@ -55,7 +55,11 @@ namespace art {
     TriggerPathsExecutor& operator=(TriggerPathsExecutor&&) = delete;
 
     // API presented to EventProcessor
-    void process(Transition, Principal&);
+    void process(hep::concurrency::WaitingTaskPtr endPathTask,
+                 Transition,
+                 Principal&);
+    void invokePrePathSignals(Transition);
+    void invokePostPathSignals(Transition) const;
     void process_event(hep::concurrency::WaitingTaskPtr endPathTask,
                        EventPrincipal&);
     void beginJob(detail::SharedResources const& resources);
@@ -69,6 +73,7 @@ namespace art {
 
   private:
     class PathsDoneTask;
+    class TransitionPathsDoneTask;
 
     bool skipNonReplicated_(Worker const&);
 
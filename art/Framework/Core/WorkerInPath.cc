@@ -71,12 +71,25 @@ namespace art {
     return counts_thrown_;
   }
 
-  bool
-  WorkerInPath::run(Transition const trans, Principal& principal)
+  void
+  WorkerInPath::run(WaitingTaskPtr workerDoneTask,
+                    Transition const trans,
+                    Principal& principal)
   {
-    // Note: We ignore the return code because we do not process events here.
-    worker_->doWork(trans, principal, moduleContext_);
-    return true;
+    // Note: There is no return code or filter action to apply because
+    // we do not process events here, so the worker notifies the path
+    // directly.
+    auto const scheduleID = moduleContext_.scheduleID();
+    TDEBUG_BEGIN_FUNC_SI(4, scheduleID);
+    try {
+      worker_->doWork(workerDoneTask, trans, principal, moduleContext_);
+    }
+    catch (...) {
+      taskGroup_->may_run(workerDoneTask, current_exception());
+      TDEBUG_END_FUNC_SI(4, scheduleID) << "because of EXCEPTION";
+      return;
+    }
+    TDEBUG_END_FUNC_SI(4, scheduleID);
   }
 
   class WorkerInPath::WorkerInPathDoneTask {
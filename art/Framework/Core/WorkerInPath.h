@@ -52,7 +52,9 @@ namespace art {
 
     // Used only by Path
     bool returnCode() const;
-    bool run(Transition, Principal&);
+    void run(hep::concurrency::WaitingTaskPtr workerDoneTask,
+             Transition,
+             Principal&);
     void run(hep::concurrency::WaitingTaskPtr workerDoneTask, EventPrincipal&);
     void clearCounters();
 
@@ -119,7 +119,8 @@ namespace art::detail {
     ++counts_run;
     ProcessingFrame const frame{mc.scheduleID()};
     bool const rc = filterWithFrame(e, frame);
-    e.commitProducts(checkPutProducts_, &expectedProducts<InEvent>());
+    e.commitProducts(
+      checkPutProducts_, &expectedProducts<InEvent>(), parentageCache_);
     if (rc) {
       ++counts_passed;
     } else {
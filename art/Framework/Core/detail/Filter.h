@@ -13,6 +13,7 @@
 #include "art/Framework/Core/ModuleMacros.h"
 #include "art/Framework/Core/ProcessingFrame.h"
 #include "art/Framework/Core/fwd.h"
+#include "art/Framework/Principal/ParentageCache.h"
 #include "art/Framework/Principal/fwd.h"
 #include "art/Persistency/Provenance/fwd.h"
 #include "art/Utilities/ScheduleID.h"
@@ -73,6 +74,7 @@ namespace art::detail {
     virtual bool filterWithFrame(Event&, ProcessingFrame const&) = 0;
 
     bool const checkPutProducts_;
+    ParentageCache parentageCache_{};
   };
 
 } // namespace art::detail
@@ -112,7 +112,8 @@ namespace art::detail {
     ++counts_run;
     ProcessingFrame const frame{mc.scheduleID()};
     produceWithFrame(e, frame);
-    e.commitProducts(checkPutProducts_, &expectedProducts<InEvent>());
+    e.commitProducts(
+      checkPutProducts_, &expectedProducts<InEvent>(), parentageCache_);
     ++counts_passed;
     return true;
   }
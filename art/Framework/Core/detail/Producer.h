@@ -11,6 +11,7 @@
 #include "art/Framework/Core/ModuleMacros.h"
 #include "art/Framework/Core/ProcessingFrame.h"
 #include "art/Framework/Core/fwd.h"
+#include "art/Framework/Principal/ParentageCache.h"
 #include "art/Framework/Principal/fwd.h"
 #include "art/Persistency/Provenance/fwd.h"
 #include "art/Utilities/ScheduleID.h"
@@ -68,6 +69,7 @@ namespace art::detail {
     virtual void produceWithFrame(Event&, ProcessingFrame const&) = 0;
 
     bool const checkPutProducts_;
+    ParentageCache parentageCache_{};
   };
 
 } // namespace art::detail
@@ -8,6 +8,7 @@
 #include "art/Framework/Core/InputSourceFactory.h"
 #include "art/Framework/Core/InputSourceMutex.h"
 #include "art/Framework/Core/ReplicatedProducer.h"
+#include "art/Framework/EventProcessor/detail/WorkerProcesses.h"
 #include "art/Framework/EventProcessor/detail/writeSummary.h"
 #include "art/Framework/Principal/ClosedRangeSetHandler.h"
 #include "art/Framework/Principal/ConsumesInfo.h"
@@ -47,10 +48,12 @@
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
 #include <cassert>
+#include <cstddef>
 #include <exception>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <string>
 #include <utility>
 #include <vector>
@@ -80,6 +83,44 @@ namespace art {
     }
 
     auto const invalid_module_context = ModuleContext::invalid();
+
+    // Each worker process of a multi-process job writes its own
+    // output files, which must therefore be named differently.
+    void
+    check_output_file_names_for_workers(ParameterSet const& outputs_pset)
+    {
+      for (auto const& label : outputs_pset.get_pset_names()) {
+        auto const fileName =
+          outputs_pset.get<ParameterSet>(label).get<string>("fileName", {});
+        if (!fileName.empty() && fileName.find("%w") == string::npos) {
+          throw Exception(errors::Configuration)
+            << "The 'fileName' parameter of output module '" << label
+            << "' (" << fileName << ")\n"
+            << "must contain the worker-index placeholder '%w' when "
+               "services.scheduler.num_processes > 1.\n";
+        }
+      }
+    }
+
+    // The worker processes are forked once beginJob has completed.  A
+    // forked process contains only the thread that called fork, so
+    // features that have started threads of their own by then cannot
+    // be used.
+    void
+    check_features_for_workers(ParameterSet const& pset)
+    {
+      if (pset.get<std::size_t>("source.prefetchFiles", 0) != 0) {
+        throw Exception(errors::Configuration)
+          << "The input source cannot prefetch files (source.prefetchFiles) "
+             "when\n"
+          << "services.scheduler.num_processes > 1.\n";
+      }
+      if (pset.has_key("services.ProcessingMonitor")) {
+        throw Exception(errors::Configuration)
+          << "The ProcessingMonitor service cannot be used when "
+             "services.scheduler.num_processes > 1.\n";
+      }
+    }
   }
 
   EventProcessor::~EventProcessor() = default;
@@ -100,6 +141,8 @@ namespace art {
                    std::move(enabled_modules)}
     , handleEmptyRuns_{scheduler_->handleEmptyRuns()}
     , handleEmptySubRuns_{scheduler_->handleEmptySubRuns()}
+    , eagerSecondaryFiles_{scheduler_->eagerSecondaryFiles()}
+    , eventSequenceNumbers_{scheduler_->num_schedules()}
   {
     auto services_pset = pset.get<ParameterSet>("services");
     auto const scheduler_pset = services_pset.get<ParameterSet>("scheduler");
@@ -124,13 +167,20 @@ namespace art {
     // we let tbb create any threads. This means they cannot use tbb
     // in their constructors, instead they must use the beginJob
     // callout.
+    if (scheduler_->num_processes() > 1) {
+      check_output_file_names_for_workers(
+        pset.get<ParameterSet>("outputs", {}));
+      check_features_for_workers(pset);
+      tbbSchedulerHandle_ = tbb::task_scheduler_handle{tbb::attach{}};
+    }
     taskGroup_ = scheduler_->global_task_group();
     // Whenever we are ready to enable ROOT's implicit MT, which is
     // equivalent to its use of TBB, the call should be made after our
     // own TBB task manager has been initialized.
     //    ROOT::EnableImplicitMT();
     TDEBUG_FUNC(5) << "nschedules: " << scheduler_->num_schedules()
-                   << " nthreads: " << scheduler_->num_threads();
+                   << " nthreads: " << scheduler_->num_threads()
+                   << " nreplicas: " << scheduler_->num_replicas();
 
     auto const errorOnMissingConsumes = scheduler_->errorOnMissingConsumes();
     ConsumesInfo::instance()->setRequireConsumes(errorOnMissingConsumes);
@@ -248,6 +298,42 @@ namespace art {
     actReg_.sPostBeginJobWorkers.invoke(input_, allWorkers);
   }
 
+  void
+  EventProcessor::forkWorkerProcesses_()
+  {
+    auto const nprocesses = scheduler_->num_processes();
+    if (nprocesses < 2) {
+      return;
+    }
+    // A forked process contains only the thread that called fork, so
+    // TBB's worker threads must exit first.  Each worker process
+    // starts its own as soon as it needs them.
+    if (!tbb::finalize(tbbSchedulerHandle_, std::nothrow)) {
+      mf::LogWarning("WorkerProcesses")
+        << "Unable to stop the TBB worker threads before forking the worker "
+           "processes.\n"
+        << "The job will be run in a single process.";
+      return;
+    }
+    workerProcesses_ = std::make_unique<detail::WorkerProcesses>(nprocesses);
+    if (workerProcesses_->isParent()) {
+      // Proceed directly to the end of the job.
+      nextLevel_ = highest_level();
+      return;
+    }
+    Globals::instance()->setProcessIndex(workerProcesses_->index());
+  }
+
+  // Skips the subrun just announced by the input source, together
+  // with its events.  Sources that can do so skip them without reading
+  // them, while keeping their bookkeeping (e.g. maxEvents) identical in
+  // all worker processes.
+  input::ItemType
+  EventProcessor::skipSubRun_()
+  {
+    return input_->skipSubRun(runPrincipal_.get());
+  }
+
   //================================================================
   // Event-loop infrastructure
 
@@ -261,7 +347,7 @@ namespace art {
     }
     if (nextLevel_.load() == L) {
       nextLevel_ = Level::ReadyToAdvance;
-      if (main_schedule().outputsToClose()) {
+      if (outputsToClose()) {
         setOutputFileStatus(OutputFileStatus::Switching);
         finalizeContainingLevels<L>();
         closeSomeOutputFiles();
@@ -287,6 +373,7 @@ namespace art {
   {
     timer_->start();
     beginJob();
+    forkWorkerProcesses_();
   }
 
   template <>
@@ -386,6 +473,12 @@ namespace art {
   void
   EventProcessor::finalize<Level::Job>()
   {
+    if (workerProcesses_ && workerProcesses_->isParent()) {
+      // The workers have done all the processing, including endJob.
+      timer_->stop();
+      workerProcesses_->waitForWorkers();
+      return;
+    }
     endJob();
     timer_->stop();
   }
@@ -523,7 +616,7 @@ namespace art {
     // recordOutputClosureRequests call is made here instead of in a
     // specialization of recordOutputModuleClosureRequests<>.
     main_schedule().recordOutputClosureRequests(Granularity::InputFile);
-    if (main_schedule().outputsToClose()) {
+    if (outputsToClose()) {
       closeSomeOutputFiles();
     }
     respondToCloseInputFile();
@@ -558,6 +651,22 @@ namespace art {
     return outputs_to_open;
   }
 
+  // The closure requests made while writing events are recorded by
+  // the schedule that wrote the event.
+  bool
+  EventProcessor::outputsToClose()
+  {
+    bool outputs_to_close{false};
+    auto check_outputs_to_close = [this,
+                                   &outputs_to_close](ScheduleID const sid) {
+      if (schedule(sid).outputsToClose()) {
+        outputs_to_close = true;
+      }
+    };
+    scheduleIteration_.for_each_schedule(check_outputs_to_close);
+    return outputs_to_close;
+  }
+
   void
   EventProcessor::openSomeOutputFiles()
   {
@@ -588,9 +697,11 @@ namespace art {
     //               flagged as needing to close.  Otherwise,
     //               'respondtoCloseOutputFiles' will be needlessly
     //               called.
-    assert(main_schedule().outputsToClose());
+    assert(outputsToClose());
     respondToCloseOutputFiles();
-    main_schedule().closeSomeOutputFiles();
+    scheduleIteration_.for_each_schedule([this](ScheduleID const sid) {
+      schedule(sid).closeSomeOutputFiles();
+    });
     FDEBUG(1) << string(8, ' ') << "closeSomeOutputFiles\n";
   }
 
@@ -649,11 +760,14 @@ namespace art {
     // are called during the sPostReadRun cannot see each others put
     // products. We enforce this by creating the groups for the
     // produced products, but do not allow the lookups to find them
-    // until after the callbacks have run.
-    runPrincipal_->createGroupsForProducedProducts(
-      producedProductLookupTables_);
-    psSignals_->sPostReadRun.invoke(*runPrincipal_);
-    runPrincipal_->enableLookupOfProducedProducts();
+    // until after the callbacks have run.  A flush run is never
+    // processed, so it needs no groups.
+    if (!runPrincipal_->runID().isFlush()) {
+      runPrincipal_->createGroupsForProducedProducts(
+        producedProductLookupTables_);
+      psSignals_->sPostReadRun.invoke(*runPrincipal_);
+      runPrincipal_->enableLookupOfProducedProducts();
+    }
     {
       auto const r =
         std::as_const(*runPrincipal_).makeRun(invalid_module_context);
@@ -678,9 +792,7 @@ namespace art {
           std::as_const(*runPrincipal_).makeRun(invalid_module_context);
         actReg_.sPreBeginRun.invoke(run);
       }
-      scheduleIteration_.for_each_schedule([this](ScheduleID const sid) {
-        schedule(sid).process(Transition::BeginRun, *runPrincipal_);
-      });
+      processTransition_(Transition::BeginRun, *runPrincipal_);
       {
         auto const run =
           std::as_const(*runPrincipal_).makeRun(invalid_module_context);
@@ -767,9 +879,7 @@ namespace art {
     try {
       actReg_.sPreEndRun.invoke(runPrincipal_->runID(),
                                 runPrincipal_->endTime());
-      scheduleIteration_.for_each_schedule([this](ScheduleID const sid) {
-        schedule(sid).process(Transition::EndRun, *runPrincipal_);
-      });
+      processTransition_(Transition::EndRun, *runPrincipal_);
       auto const r =
         std::as_const(*runPrincipal_).makeRun(invalid_module_context);
       actReg_.sPostEndRun.invoke(r);
@@ -798,6 +908,15 @@ namespace art {
     RunID const r{runPrincipal_->runID()};
     assert(!r.isFlush());
     main_schedule().writeRun(*runPrincipal_);
+    if (main_schedule().fileStatus() == OutputFileStatus::Switching) {
+      // Whichever schedule writes them, the events that follow belong
+      // to the new output files.
+      unique_ptr<RangeSetHandler> rsh{
+        main_schedule().runRangeSetHandler().clone()};
+      scheduleIteration_.for_each_schedule([this, &rsh](ScheduleID const sid) {
+        schedule(sid).seedRunRangeSet(*rsh);
+      });
+    }
     FDEBUG(1) << string(8, ' ') << "writeRun....................(" << r
               << ")\n";
   }
@@ -821,11 +940,14 @@ namespace art {
     // are called during the sPostReadSubRun cannot see each others
     // put products. We enforce this by creating the groups for the
     // produced products, but do not allow the lookups to find them
-    // until after the callbacks have run.
-    subRunPrincipal_->createGroupsForProducedProducts(
-      producedProductLookupTables_);
-    psSignals_->sPostReadSubRun.invoke(*subRunPrincipal_);
-    subRunPrincipal_->enableLookupOfProducedProducts();
+    // until after the callbacks have run.  A flush subrun is never
+    // processed, so it needs no groups.
+    if (!subRunPrincipal_->subRunID().isFlush()) {
+      subRunPrincipal_->createGroupsForProducedProducts(
+        producedProductLookupTables_);
+      psSignals_->sPostReadSubRun.invoke(*subRunPrincipal_);
+      subRunPrincipal_->enableLookupOfProducedProducts();
+    }
     {
       auto const sr =
         std::as_const(*subRunPrincipal_).makeSubRun(invalid_module_context);
@@ -850,9 +972,7 @@ namespace art {
           std::as_const(*subRunPrincipal_).makeSubRun(invalid_module_context);
         actReg_.sPreBeginSubRun.invoke(srun);
       }
-      scheduleIteration_.for_each_schedule([this](ScheduleID const sid) {
-        schedule(sid).process(Transition::BeginSubRun, *subRunPrincipal_);
-      });
+      processTransition_(Transition::BeginSubRun, *subRunPrincipal_);
       {
         auto const srun =
           std::as_const(*subRunPrincipal_).makeSubRun(invalid_module_context);
@@ -942,32 +1062,33 @@ namespace art {
     // Since we are using already existing ranges, all the range set
     // handlers have the same ranges.  Find the closed range set
     // handler with the largest event number, that will be the one
-    // which we will use as the file switch boundary.  Note that is
-    // may not match the exactly the schedule that triggered the
-    // switch.  Do we need to fix this?
+    // which we will use as the file switch boundary.  The events are
+    // routed to the output files in the order they were read, so that
+    // is the last event written to the files being closed.
     //
     // If we do not find any handlers with valid event info then we
     // use the first one, which is just fine.  This happens for
     // example when we are dropping all events.
     unsigned largestEvent = 1U;
     ScheduleID idxOfMax{ScheduleID::first()};
-    ScheduleID idx{ScheduleID::first()};
-    auto& val = main_schedule().subRunRangeSetHandler();
-    auto& rsh = dynamic_cast<ClosedRangeSetHandler const&>(val);
-    // Make sure the event number is a valid event number before using
-    // it. It can be invalid in the handler if we have not yet read an
-    // event, which happens with empty subruns and when we are
-    // dropping all events.
-    if (rsh.eventInfo().id().isValid() && !rsh.eventInfo().id().isFlush()) {
-      if (rsh.eventInfo().id().event() > largestEvent) {
-        largestEvent = rsh.eventInfo().id().event();
-        idxOfMax = idx;
+    auto find_largest_event = [this, &largestEvent, &idxOfMax](
+                                ScheduleID const sid) {
+      auto& val = schedule(sid).subRunRangeSetHandler();
+      auto& rsh = dynamic_cast<ClosedRangeSetHandler const&>(val);
+      // Make sure the event number is a valid event number before
+      // using it. It can be invalid in the handler if we have not yet
+      // read an event, which happens with empty subruns and when we
+      // are dropping all events.
+      auto const& id = rsh.eventInfo().id();
+      if (id.isValid() && !id.isFlush() && id.event() > largestEvent) {
+        largestEvent = id.event();
+        idxOfMax = sid;
       }
-    }
-    idx = idx.next();
+    };
+    scheduleIteration_.for_each_schedule(find_largest_event);
 
     unique_ptr<RangeSetHandler> rshAtSwitch{
-      main_schedule().subRunRangeSetHandler().clone()};
+      schedule(idxOfMax).subRunRangeSetHandler().clone()};
     if (main_schedule().fileStatus() == OutputFileStatus::Switching) {
       rshAtSwitch->maybeSplitRange();
       unique_ptr<RangeSetHandler> runRSHAtSwitch{
@@ -996,9 +1117,7 @@ namespace art {
     try {
       actReg_.sPreEndSubRun.invoke(subRunPrincipal_->subRunID(),
                                    subRunPrincipal_->endTime());
-      scheduleIteration_.for_each_schedule([this](ScheduleID const sid) {
-        schedule(sid).process(Transition::EndSubRun, *subRunPrincipal_);
-      });
+      processTransition_(Transition::EndSubRun, *subRunPrincipal_);
       auto const srun =
         std::as_const(*subRunPrincipal_).makeSubRun(invalid_module_context);
       actReg_.sPostEndSubRun.invoke(srun);
@@ -1027,10 +1146,78 @@ namespace art {
     SubRunID const& sr{subRunPrincipal_->subRunID()};
     assert(!sr.isFlush());
     main_schedule().writeSubRun(*subRunPrincipal_);
+    if (main_schedule().fileStatus() == OutputFileStatus::Switching) {
+      // As for writeRun.
+      unique_ptr<RangeSetHandler> rsh{
+        main_schedule().subRunRangeSetHandler().clone()};
+      scheduleIteration_.for_each_schedule([this, &rsh](ScheduleID const sid) {
+        schedule(sid).seedSubRunRangeSet(*rsh);
+      });
+    }
     FDEBUG(1) << string(8, ' ') << "writeSubRun.................(" << sr
               << ")\n";
   }
 
+  //=============================================
+  // Run and SubRun transitions
+
+  class EventProcessor::TransitionDoneTask {
+  public:
+    explicit TransitionDoneTask(SharedException& sharedException)
+      : sharedException_{sharedException}
+    {}
+
+    void
+    operator()(exception_ptr const ex) const
+    {
+      if (ex) {
+        sharedException_.store(ex);
+      }
+    }
+
+  private:
+    SharedException& sharedException_;
+  };
+
+  // All schedules process the transition concurrently, using the same
+  // task-based path machinery as is used for events: within a
+  // schedule, the trigger paths run concurrently, and the end path is
+  // run once they have all finished.  Modules that require
+  // serialization are run on their serial task queues.  The main
+  // thread waits until all schedules are done.
+  //
+  // The path signals are invoked here, once per transition, for the
+  // paths of the first schedule, which run every worker: all pre-path
+  // signals before any schedule starts, and all post-path signals, in
+  // the same order, once every schedule has finished.
+  void
+  EventProcessor::processTransition_(Transition const trans,
+                                     Principal& principal)
+  {
+    auto& firstSchedule = schedule(ScheduleID::first());
+    firstSchedule.invokePrePathSignals(trans);
+    SharedException transitionException;
+    auto transitionDoneTask = std::make_shared<WaitingTask>(
+      TransitionDoneTask{transitionException}, scheduler_->num_schedules());
+    auto process_schedule = [this, trans, &principal, &transitionDoneTask](
+                              ScheduleID const sid) {
+      try {
+        schedule(sid).process(transitionDoneTask, trans, principal);
+      }
+      catch (...) {
+        taskGroup_->may_run(transitionDoneTask, current_exception());
+      }
+    };
+    scheduleIteration_.for_each_schedule(
+      [this, &process_schedule](ScheduleID const sid) {
+        taskGroup_->run(sid,
+                        [&process_schedule, sid] { process_schedule(sid); });
+      });
+    taskGroup_->wait();
+    firstSchedule.invokePostPathSignals(trans);
+    transitionException.throw_if_stored_exception();
+  }
+
   // ==============================================================================
   // Event level
 
@@ -1044,35 +1231,49 @@ namespace art {
     // Note: This loop is to allow output file switching to happen in
     // the main thread.
     firstEvent_ = true;
-    bool done = false;
-    while (!done) {
+    bool noMoreEvents{false};
+    while (true) {
       beginRunIfNotDoneAlready();
       beginSubRunIfNotDoneAlready();
 
-      auto const last_schedule_index = scheduler_->num_schedules() - 1;
-      for (ScheduleID::size_type i = 0; i != last_schedule_index; ++i) {
-        taskGroup_->run([this, i] { processAllEventsAsync(ScheduleID(i)); });
-      }
-      taskGroup_->native_group().run_and_wait([this, last_schedule_index] {
-        processAllEventsAsync(ScheduleID(last_schedule_index));
-      });
-
-      // If anything bad happened during event processing, let the
-      // user know.
+      // The events held back by the previous switch go to the new
+      // output files.  They may fill those files as well.
+      writeHeldEvents_();
       sharedException_.throw_if_stored_exception();
-      if (!fileSwitchInProgress_.load()) {
-        done = true;
-        continue;
+      if (!noMoreEvents && !outputSwitchRequested_.load()) {
+        // Each schedule's events are processed in its own task arena,
+        // if NUMA placement has been requested.
+        scheduleIteration_.for_each_schedule([this](ScheduleID const sid) {
+          taskGroup_->run(sid, [this, sid] { processAllEventsAsync(sid); });
+        });
+        taskGroup_->wait();
+
+        // If anything bad happened during event processing, let the
+        // user know.
+        sharedException_.throw_if_stored_exception();
+
+        // Unless one of them started an output-file switch, the
+        // schedules stopped because there are no more events to read
+        // in this subrun.
+        noMoreEvents = !fileSwitchInProgress_.load();
       }
+      if (!outputSwitchRequested_.load() ||
+          (noMoreEvents && heldEvents_.empty())) {
+        // A closure requested by the last event written is honored
+        // at the next subrun, run, or input-file boundary, as usual.
+        break;
+      }
+      // Switch the output files now: either the next event has been
+      // reached, or events are being held for the new files.  The
+      // switch is made here, with every schedule drained, because
+      // closing the files runs the endSubRun and endRun transitions,
+      // which cannot overlap event processing.  The events that were
+      // read before the one that filled the files, and were still
+      // being processed, have been written to the closing files, so
+      // these can hold up to nschedules-1 events beyond their limit.
       setOutputFileStatus(OutputFileStatus::Switching);
       finalizeContainingLevels<most_deeply_nested_level()>();
-      respondToCloseOutputFiles();
-      main_schedule().closeSomeOutputFiles();
-      FDEBUG(1) << string(8, ' ') << "closeSomeOutputFiles\n";
-      // We started the switch after advancing to the next item type;
-      // we must make sure that we read that event before advancing
-      // the item type again.
-      firstEvent_ = true;
+      closeSomeOutputFiles();
       fileSwitchInProgress_ = false;
     }
   }
@@ -1124,6 +1325,7 @@ namespace art {
     // The item type advance and the event read must be done with the
     // input source lock held; however event-processing must not
     // serialized.
+    bool flush{false};
     {
       InputSourceMutexSentry lock_input;
       if (fileSwitchInProgress_.load()) {
@@ -1134,12 +1336,11 @@ namespace art {
         // event that the first schedule which noticed we needed a
         // switch had advanced the iterator to.
 
-        // Note: We still have the problem that because the schedules
-        // do not read events at the same time the file switch point
-        // can be up to nschedules-1 ahead of where it would have been
-        // if there was only one schedule.  If we are switching output
-        // files every event in an attempt to create single event
-        // files, this really does not work out too well.
+        // Note: Events that were already being processed when the
+        // switch was requested go to the closing files if they were
+        // read before the event whose writing requested the switch;
+        // the others are held by their schedules, and are written to
+        // the new files once they are open (see finishEventAsync).
         TDEBUG_END_FUNC_SI(4, sid) << "FILE SWITCH";
         return;
       }
@@ -1172,8 +1373,12 @@ namespace art {
         // an event and we must do that before dropping the lock on
         // the input source which is what is protecting us against a
         // double-advance caused by a different schedule.
-        if (schedule(sid).outputsToClose()) {
+        if (outputSwitchRequested_.load()) {
           fileSwitchInProgress_ = true;
+          // We started the switch after advancing to the next item
+          // type; we must make sure that we read that event before
+          // advancing the item type again.
+          firstEvent_ = true;
           TDEBUG_END_FUNC_SI(4, sid) << "FILE SWITCH INITIATED";
           return;
         }
@@ -1187,29 +1392,46 @@ namespace art {
       TDEBUG_FUNC_SI(5, sid) << "Calling input_->readEvent(subRunPrincipal_)";
       auto ep = input_->readEvent(subRunPrincipal_.get());
       assert(ep);
+      flush = ep->eventID().isFlush();
       // The intended behavior here is that the producing services
       // which are called during the sPostReadEvent cannot see each
       // others put products.  We enforce this by creating the groups
       // for the produced products, but do not allow the lookups to
-      // find them until after the callbacks have run.
-      ep->createGroupsForProducedProducts(producedProductLookupTables_);
-      psSignals_->sPostReadEvent.invoke(*ep);
-      ep->enableLookupOfProducedProducts();
+      // find them until after the callbacks have run.  A flush event
+      // is never processed, so it needs no groups, and it is
+      // discarded instead of being handed to the schedule.
+      if (!flush) {
+        ep->createGroupsForProducedProducts(producedProductLookupTables_);
+        psSignals_->sPostReadEvent.invoke(*ep);
+        ep->enableLookupOfProducedProducts();
+      }
       actReg_.sPostSourceEvent.invoke(
         std::as_const(*ep).makeEvent(invalid_module_context), sc);
       FDEBUG(1) << string(8, ' ') << "readEvent...................("
                 << ep->eventID() << ")\n";
-      schedule(sid).accept_principal(std::move(ep));
+      if (!flush) {
+        eventSequenceNumbers_[sid] = nextEventSequenceNumber_++;
+        schedule(sid).accept_principal(std::move(ep));
+      }
       // Now we drop the input source lock by exiting the guarded
       // scope.
     }
-    if (schedule(sid).event_principal().eventID().isFlush()) {
+    if (flush) {
       // No processing to do, start next event handling task.
       processAllEventsAsync(sid);
       TDEBUG_END_FUNC_SI(4, sid) << "FLUSH EVENT";
       return;
     }
 
+    // Open the secondary files now that the input source lock has been
+    // dropped, so that schedules can do so concurrently.  Each
+    // principal serializes the opening of its own secondary files; the
+    // delayed readers serialize any access to a shared input file, as
+    // they must for lazily opened files (see DelayedReader.h).
+    if (eagerSecondaryFiles_) {
+      schedule(sid).event_principal().openAllSecondaryFiles();
+    }
+
     // Now process the event.
     processEventAsync(sid);
     TDEBUG_END_FUNC_SI(4, sid);
@@ -1425,27 +1647,18 @@ namespace art {
       // if so setup to end the job the next time around the event
       // loop.
       FDEBUG(1) << string(8, ' ') << "shouldWeStop\n";
-      static std::mutex m;
-      std::lock_guard sentry{m};
-      // Now we can write the results of processing to the outputs,
-      // and delete the event principal.
-      if (!ep.eventID().isFlush()) {
-        // Possibly open new output files.  This is safe to do because
-        // EndPathExecutor functions are called in a serialized
-        // context.
-        TDEBUG_FUNC_SI(5, sid) << "Calling openSomeOutputFiles()";
-        openSomeOutputFiles();
-        TDEBUG_FUNC_SI(5, sid) << "Calling schedule(sid).writeEvent()";
-
-        auto const id = ep.eventID();
-        schedule(sid).writeEvent();
-        FDEBUG(1) << string(8, ' ') << "writeEvent..................(" << id
-                  << ")\n";
+      std::lock_guard sentry{eventWriteMutex_};
+      auto const seqNum = eventSequenceNumbers_[sid];
+      if (outputSwitchRequested_.load() && seqNum > switchSequenceNumber_) {
+        // The output files are about to be switched, and this event,
+        // read after the one that filled them, belongs in the new
+        // ones.  Hold it, and read no more events on this schedule,
+        // until the switch has been made.
+        heldEvents_.emplace(seqNum, sid);
+        TDEBUG_END_FUNC_SI(4, sid) << "EVENT HELD FOR OUTPUT-FILE SWITCH";
+        return;
       }
-      TDEBUG_FUNC_SI(5, sid)
-        << "Calling schedules_->"
-           "recordOutputClosureRequests(Granularity::Event)";
-      schedule(sid).recordOutputClosureRequests(Granularity::Event);
+      writeEvent_(sid);
     }
     catch (cet::exception& e) {
       if (error_action(e) != actions::IgnoreCompletely) {
@@ -1473,10 +1686,89 @@ namespace art {
     }
 
     // The next event processing task is a continuation of this task.
-    processAllEventsAsync(sid);
+    // With NUMA placement, this task may be running in another
+    // schedule's arena (e.g. after a serialized module), so the next
+    // event is read in this schedule's own arena, where its principal
+    // is then made.
+    if (taskGroup_->n_arenas() != 0) {
+      taskGroup_->run(sid, [this, sid] { processAllEventsAsync(sid); });
+    } else {
+      processAllEventsAsync(sid);
+    }
     TDEBUG_END_FUNC_SI(4, sid);
   }
 
+  // Writes the results of processing to the outputs.  Must be called
+  // with eventWriteMutex_ held.
+  void
+  EventProcessor::writeEvent_(ScheduleID const sid)
+  {
+    auto const& ep = schedule(sid).event_principal();
+    if (!ep.eventID().isFlush()) {
+      // Possibly open new output files.  This is safe to do because
+      // EndPathExecutor functions are called in a serialized context.
+      TDEBUG_FUNC_SI(5, sid) << "Calling openSomeOutputFiles()";
+      openSomeOutputFiles();
+      TDEBUG_FUNC_SI(5, sid) << "Calling schedule(sid).writeEvent()";
+
+      auto const id = ep.eventID();
+      schedule(sid).writeEvent();
+      FDEBUG(1) << string(8, ' ') << "writeEvent..................(" << id
+                << ")\n";
+    }
+    TDEBUG_FUNC_SI(5, sid)
+      << "Calling schedules_->"
+         "recordOutputClosureRequests(Granularity::Event)";
+    schedule(sid).recordOutputClosureRequests(Granularity::Event);
+    if (schedule(sid).outputsToClose() && !outputSwitchRequested_.load()) {
+      // Events read after this one go to the new output files.
+      switchSequenceNumber_ = eventSequenceNumbers_[sid];
+      outputSwitchRequested_ = true;
+    }
+  }
+
+  // Writes the events held during the last output-file switch to the
+  // new files, in the order they were read.  Should one of them lead
+  // to another request for the files to be closed, the events read
+  // after it remain held for the next switch.  Exceptions are handled
+  // as in finishEventAsync: unless they are to be ignored, they are
+  // stored for the main thread, and the remaining events are dropped.
+  void
+  EventProcessor::writeHeldEvents_()
+  {
+    std::lock_guard sentry{eventWriteMutex_};
+    outputSwitchRequested_ = false;
+    while (!heldEvents_.empty() && !outputSwitchRequested_.load()) {
+      auto const sid = heldEvents_.cbegin()->second;
+      heldEvents_.erase(heldEvents_.cbegin());
+      try {
+        writeEvent_(sid);
+      }
+      catch (cet::exception& e) {
+        if (error_action(e) != actions::IgnoreCompletely) {
+          sharedException_.store<Exception>(
+            errors::EventProcessorFailure,
+            "EventProcessor: an exception occurred "
+            "during current event processing",
+            e);
+          heldEvents_.clear();
+          return;
+        }
+        mf::LogWarning(e.category())
+          << "exception being ignored for current event:\n"
+          << cet::trim_right_copy(e.what(), " \n");
+        // WARNING: We continue with the next held event!!!
+      }
+      catch (...) {
+        mf::LogError("PassingThrough")
+          << "an exception occurred during current event processing";
+        sharedException_.store_current();
+        heldEvents_.clear();
+        return;
+      }
+    }
+  }
+
   template <Level L>
   void
   EventProcessor::process()
@@ -1515,7 +1807,15 @@ namespace art {
   Level
   EventProcessor::advanceItemType()
   {
-    auto const itemType = input_->nextItemType();
+    auto itemType = input_->nextItemType();
+    if (workerProcesses_) {
+      // Skip the subruns assigned to the other worker processes.
+      assert(!workerProcesses_->isParent());
+      while (itemType == input::IsSubRun &&
+             !workerProcesses_->ownsNextSubRun()) {
+        itemType = skipSubRun_();
+      }
+    }
     FDEBUG(1) << string(4, ' ') << "*** nextItemType: " << itemType << " ***\n";
     switch (itemType) {
     case input::IsStop:
@@ -18,6 +18,7 @@
 #include "art/Framework/Core/fwd.h"
 #include "art/Framework/EventProcessor/Scheduler.h"
 #include "art/Framework/EventProcessor/detail/ExceptionCollector.h"
+#include "art/Framework/EventProcessor/detail/WorkerProcesses.h"
 #include "art/Framework/Principal/Actions.h"
 #include "art/Framework/Principal/EventPrincipal.h"
 #include "art/Framework/Principal/RunPrincipal.h"
@@ -34,9 +35,13 @@
 #include "cetlib/cpu_timer.h"
 #include "fhiclcpp/fwd.h"
 #include "hep_concurrency/thread_sanitize.h"
+#include "tbb/global_control.h"
 
 #include <atomic>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
 
 namespace art {
 
@@ -76,12 +81,15 @@ namespace art {
   private:
     class EndPathTask;
     class EndPathRunnerTask;
+    class TransitionDoneTask;
 
     // Event-loop infrastructure
     void processAllEventsAsync(ScheduleID sid);
     void readAndProcessAsync(ScheduleID sid);
     void processEventAsync(ScheduleID sid);
     void finishEventAsync(ScheduleID sid);
+    void writeEvent_(ScheduleID sid);
+    void writeHeldEvents_();
 
     template <Level L>
     bool levelsToProcess();
@@ -107,6 +115,7 @@ namespace art {
     void endJobAllSchedules();
     void openInputFile();
     bool outputsToOpen();
+    bool outputsToClose();
     void openSomeOutputFiles();
     void closeInputFile();
     void closeSomeOutputFiles();
@@ -131,8 +140,11 @@ namespace art {
     void readEvent();
     void processEvent();
     void writeEvent();
+    void processTransition_(Transition, Principal&);
     void setOutputFileStatus(OutputFileStatus);
     void invokePostBeginJobWorkers_();
+    void forkWorkerProcesses_();
+    input::ItemType skipSubRun_();
     void terminateAbnormally_();
 
   private:
@@ -251,6 +263,10 @@ namespace art {
     // Are we configured to process empty subruns?
     bool const handleEmptySubRuns_;
 
+    // Are we configured to open secondary files as soon as an event is
+    // read?
+    bool const eagerSecondaryFiles_;
+
     // Used to communicate exceptions from worker threads to the main
     // thread.
     SharedException sharedException_;
@@ -264,6 +280,31 @@ namespace art {
 
     // Are we current switching output files?
     std::atomic<bool> fileSwitchInProgress_{false};
+
+    // The order in which the events now being processed were read,
+    // used to route them to the output files.  The counter is guarded
+    // by the input source lock.
+    std::uint64_t nextEventSequenceNumber_{};
+    PerScheduleContainer<std::uint64_t> eventSequenceNumbers_;
+
+    // Serializes the writing of events.  Once writing an event has led
+    // output modules to request that their files be closed, the events
+    // read before that one are still written to the closing files;
+    // those read after it are held by their schedules, and are written
+    // to the new files, in the order they were read, once these have
+    // been opened.
+    std::mutex eventWriteMutex_{};
+    std::atomic<bool> outputSwitchRequested_{false};
+    std::uint64_t switchSequenceNumber_{};
+    std::map<std::uint64_t, ScheduleID> heldEvents_{};
+
+    // For multi-process jobs, used to stop TBB's worker threads
+    // before forking the worker processes.
+    tbb::task_scheduler_handle tbbSchedulerHandle_{};
+
+    // For multi-process jobs, the worker processes forked after
+    // beginJob.
+    std::unique_ptr<detail::WorkerProcesses> workerProcesses_{nullptr};
   };
 
 } // namespace art
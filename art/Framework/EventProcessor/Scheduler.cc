@@ -3,6 +3,7 @@
 
 #include "art/Utilities/GlobalTaskGroup.h"
 #include "art/Utilities/Globals.h"
+#include "art/Utilities/PluginIndex.h"
 #include "cetlib/HorizontalRule.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 #include "tbb/global_control.h"
@@ -50,9 +51,13 @@ namespace art {
     : actionTable_{ps().actionTable()}
     , nThreads_{adjust_num_threads(ps().num_threads())}
     , nSchedules_{ps().num_schedules()}
+    , nReplicas_{ps().num_replicas()}
+    , nProcesses_{ps().num_processes()}
     , stackSize_{ps().stack_size()}
     , handleEmptyRuns_{ps().handleEmptyRuns()}
     , handleEmptySubRuns_{ps().handleEmptySubRuns()}
+    , eagerSecondaryFiles_{ps().eagerSecondaryFiles()}
+    , numaPlacement_{ps().numaPlacement()}
     , errorOnMissingConsumes_{ps().errorOnMissingConsumes()}
     , wantSummary_{ps().wantSummary()}
     , dataDependencyGraph_{ps().dataDependencyGraph()}
@@ -60,6 +65,12 @@ namespace art {
     auto& globals = *Globals::instance();
     globals.setNThreads(nThreads_);
     globals.setNSchedules(nSchedules_);
+    globals.setNReplicas(nReplicas_);
+    globals.setNProcesses(nProcesses_);
+    PluginIndex::setUseCache(ps().pluginCache());
+    if (ps().rebuildPluginCache()) {
+      PluginIndex::rebuildCache();
+    }
   }
 
   std::unique_ptr<GlobalTaskGroup>
@@ -69,11 +80,20 @@ namespace art {
     auto value_of = [](auto const field) {
       return global_control::active_value(field);
     };
-    auto group = std::make_unique<GlobalTaskGroup>(nThreads_, stackSize_);
-    mf::LogInfo("MTdiagnostics")
-      << "TBB has been configured to use:\n"
-      << "  - a maximum of " << value_of(max_parallelism) << " threads\n"
-      << "  - a stack size of " << value_of(thread_stack_size) << " bytes";
+    auto group =
+      std::make_unique<GlobalTaskGroup>(nThreads_, stackSize_, numaPlacement_);
+    mf::LogInfo log{"MTdiagnostics"};
+    log << "TBB has been configured to use:\n"
+        << "  - a maximum of " << value_of(max_parallelism) << " threads\n"
+        << "  - a stack size of " << value_of(thread_stack_size) << " bytes";
+    if (numaPlacement_) {
+      if (auto const n = group->n_arenas()) {
+        log << "\n  - one task arena for each of " << n << " NUMA nodes";
+      } else {
+        log << "\n  - no NUMA placement (TBB reports a single node, or "
+               "there are too few threads)";
+      }
+    }
     return group;
   }
 }
@@ -33,6 +33,47 @@ namespace art {
       fhicl::Atom<unsigned> num_threads{Name{"num_threads"}, 1};
       fhicl::Atom<ScheduleID::size_type> num_schedules{Name{"num_schedules"},
                                                        1};
+      fhicl::Atom<ScheduleID::size_type> num_replicas{
+        Name{"num_replicas"},
+        Comment{
+          "The number of copies made of each replicated module.  If it is "
+          "smaller\n"
+          "than 'num_schedules', schedule i uses copy i % num_replicas, and "
+          "the\n"
+          "schedules sharing a copy take turns running it.  An event whose "
+          "copy\n"
+          "is busy waits in a task queue instead of holding a thread, so "
+          "that\n"
+          "more events than threads can be in flight without replicating "
+          "the\n"
+          "modules for each of them.  A shared copy is constructed with "
+          "the\n"
+          "ProcessingFrame of the first schedule that uses it, and is "
+          "then\n"
+          "called for each event with the frame of the event's schedule.  "
+          "A module\n"
+          "must therefore not key per-schedule state (e.g. random-number "
+          "engines,\n"
+          "which are refused) on the schedule it was constructed for.  The "
+          "default\n"
+          "(0) makes one copy per schedule."},
+        0};
+      fhicl::Atom<unsigned> num_processes{
+        Name{"num_processes"},
+        Comment{
+          "If greater than 1, the job is initialized once, up to and "
+          "including\n"
+          "beginJob, after which 'num_processes' worker processes are forked\n"
+          "that share the initialized memory copy-on-write.  Worker i "
+          "processes\n"
+          "every num_processes-th subrun of the input, starting with subrun "
+          "i, and\n"
+          "writes its own output files, whose 'fileName' patterns must "
+          "therefore\n"
+          "contain the '%w' (worker index) placeholder.  The original process "
+          "waits\n"
+          "for the workers and reports their exit status."},
+        1};
       fhicl::Atom<unsigned> stack_size{
         Name{"stack_size"},
         Comment{"The stack size (in bytes) that the TBB scheduler will use for "
@@ -45,12 +86,48 @@ namespace art {
         10 * mb()};
       fhicl::Atom<bool> handleEmptyRuns{Name{"handleEmptyRuns"}, true};
       fhicl::Atom<bool> handleEmptySubRuns{Name{"handleEmptySubRuns"}, true};
+      fhicl::Atom<bool> eagerSecondaryFiles{
+        Name{"eagerSecondaryFiles"},
+        Comment{"If true, all secondary input files for an event are opened "
+                "as soon as\n"
+                "the event has been read, in the event's own schedule.  "
+                "Otherwise, a\n"
+                "secondary file is opened only when a product lookup "
+                "requires it."},
+        false};
+      fhicl::Atom<bool> numaPlacement{
+        Name{"numaPlacement"},
+        Comment{"If true, and TBB reports more than one NUMA node, the TBB "
+                "threads are\n"
+                "divided among one task arena per node, and each schedule "
+                "is assigned\n"
+                "to one of those arenas.  Its events are read, and its "
+                "copies of\n"
+                "replicated modules are constructed, on that node.  Tasks "
+                "of serialized\n"
+                "modules may still run on another node.  This requires "
+                "TBB's hwloc\n"
+                "binding library."},
+        false};
       fhicl::Atom<bool> errorOnMissingConsumes{Name{"errorOnMissingConsumes"},
                                                false};
       fhicl::Atom<bool> errorOnSIGINT{Name{"errorOnSIGINT"}, true};
       fhicl::Atom<bool> wantSummary{Name{"wantSummary"}, false};
       fhicl::Atom<bool> pruneConfig{Name{"pruneConfig"}, true};
       fhicl::Atom<bool> reportUnused{Name{"reportUnused"}, true};
+      fhicl::Atom<bool> pluginCache{
+        Name{"pluginCache"},
+        Comment{"If true, plugin libraries are located through an on-disk "
+                "index of the\n"
+                "plugin search path, which is rebuilt whenever a directory "
+                "of that path\n"
+                "changes.  See art/Utilities/PluginIndex.h."},
+        true};
+      fhicl::Atom<bool> rebuildPluginCache{
+        Name{"rebuildPluginCache"},
+        Comment{"If true, the plugin index is rebuilt even if it appears "
+                "to be current."},
+        false};
       fhicl::Atom<std::string> dataDependencyGraph{Name{"dataDependencyGraph"},
                                                    {}};
       struct DebugConfig {
@@ -85,6 +162,16 @@ namespace art {
     {
       return nSchedules_;
     }
+    ScheduleID::size_type
+    num_replicas() const noexcept
+    {
+      return nReplicas_;
+    }
+    unsigned
+    num_processes() const noexcept
+    {
+      return nProcesses_;
+    }
     bool
     handleEmptyRuns() const noexcept
     {
@@ -96,6 +183,16 @@ namespace art {
       return handleEmptySubRuns_;
     }
     bool
+    eagerSecondaryFiles() const noexcept
+    {
+      return eagerSecondaryFiles_;
+    }
+    bool
+    numaPlacement() const noexcept
+    {
+      return numaPlacement_;
+    }
+    bool
     errorOnMissingConsumes() const noexcept
     {
       return errorOnMissingConsumes_;
@@ -119,9 +216,13 @@ namespace art {
     ActionTable actionTable_;
     unsigned const nThreads_;
     unsigned const nSchedules_;
+    unsigned const nReplicas_;
+    unsigned const nProcesses_;
     unsigned const stackSize_;
     bool const handleEmptyRuns_;
     bool const handleEmptySubRuns_;
+    bool const eagerSecondaryFiles_;
+    bool const numaPlacement_;
     bool const errorOnMissingConsumes_;
     bool const wantSummary_;
     std::string const dataDependencyGraph_;
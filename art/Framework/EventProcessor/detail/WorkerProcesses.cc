@@ -0,0 +1,210 @@
+#include "art/Framework/EventProcessor/detail/WorkerProcesses.h"
+// vim: set sw=2 expandtab :
+
+#include "canvas/Utilities/Exception.h"
+#include "cetlib/HorizontalRule.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+  double
+  seconds(timeval const& tv)
+  {
+    return tv.tv_sec + 1e-6 * tv.tv_usec;
+  }
+
+  std::string
+  describe(int const status)
+  {
+    std::ostringstream os;
+    if (WIFEXITED(status)) {
+      os << "exit status " << WEXITSTATUS(status);
+    } else if (WIFSIGNALED(status)) {
+      os << "terminated by signal " << WTERMSIG(status);
+    } else {
+      os << "unknown status " << status;
+    }
+    return os.str();
+  }
+
+#ifdef __linux__
+  std::vector<std::string>
+  entries(std::string const& dir)
+  {
+    std::vector<std::string> result;
+    auto* d = opendir(dir.c_str());
+    if (d == nullptr) {
+      return result;
+    }
+    while (auto const* entry = readdir(d)) {
+      if (entry->d_name[0] != '.') {
+        result.emplace_back(entry->d_name);
+      }
+    }
+    closedir(d);
+    return result;
+  }
+
+  // Files other than the standard streams that are open for reading.
+  // Their file offsets would be shared by all of the workers.
+  std::vector<std::string>
+  files_open_for_reading()
+  {
+    std::vector<std::string> result;
+    for (auto const& name : entries("/proc/self/fd")) {
+      auto const fd = std::stoi(name);
+      struct stat sb;
+      if (fd <= STDERR_FILENO || fstat(fd, &sb) != 0 || !S_ISREG(sb.st_mode)) {
+        continue;
+      }
+      auto const flags = fcntl(fd, F_GETFL);
+      if (flags < 0 || (flags & O_ACCMODE) == O_WRONLY) {
+        continue;
+      }
+      char path[PATH_MAX];
+      auto const link = "/proc/self/fd/" + name;
+      auto const n = readlink(link.c_str(), path, sizeof path);
+      result.push_back(n < 0 ? link : std::string(path, n));
+    }
+    return result;
+  }
+#endif
+
+  // A forked process contains only the thread that called fork, and
+  // shares the open files of its parent.  Only Linux provides the
+  // information needed to check for either.
+  void
+  throw_unless_forkable()
+  {
+#ifdef __linux__
+    auto const nthreads = entries("/proc/self/task").size();
+    auto const files = files_open_for_reading();
+    if (nthreads <= 1 && files.empty()) {
+      return;
+    }
+    std::ostringstream os;
+    if (nthreads > 1) {
+      os << "  " << nthreads - 1
+         << " thread(s) besides the main one are running\n";
+    }
+    for (auto const& file : files) {
+      os << "  " << file << " is open for reading\n";
+    }
+    throw art::Exception{art::errors::Configuration}
+      << "The worker processes cannot be forked after beginJob, as\n"
+      << os.str()
+      << "Please disable the services or modules responsible, or set\n"
+      << "services.scheduler.num_processes to 1.\n";
+#endif
+  }
+}
+
+art::detail::WorkerProcesses::WorkerProcesses(unsigned const nprocesses)
+  : nprocesses_{nprocesses}
+{
+  assert(nprocesses_ > 1);
+  throw_unless_forkable();
+  // Anything still buffered would otherwise be written once by each
+  // process.
+  mf::FlushMessageLog();
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+
+  for (unsigned i = 0; i != nprocesses_; ++i) {
+    auto const pid = fork();
+    if (pid == 0) {
+      index_ = i;
+      pids_.clear();
+      mf::LogInfo("WorkerProcesses")
+        << "Worker " << i << " of " << nprocesses_ << " started (pid "
+        << getpid() << ").";
+      return;
+    }
+    if (pid < 0) {
+      auto const err = errno;
+      // Do not leave the workers already started to run unattended.
+      for (auto const p : pids_) {
+        kill(p, SIGTERM);
+      }
+      throw Exception{errors::EventProcessorFailure}
+        << "Unable to fork worker process " << i << " of " << nprocesses_
+        << ": " << std::strerror(err) << ".\n";
+    }
+    pids_.push_back(pid);
+  }
+}
+
+unsigned
+art::detail::WorkerProcesses::index() const
+{
+  assert(!isParent());
+  return *index_;
+}
+
+bool
+art::detail::WorkerProcesses::ownsNextSubRun() noexcept
+{
+  assert(!isParent());
+  return subRunsSeen_++ % nprocesses_ == *index_;
+}
+
+void
+art::detail::WorkerProcesses::waitForWorkers()
+{
+  assert(isParent());
+  std::vector<int> statuses(nprocesses_);
+  std::vector<rusage> usages(nprocesses_);
+  for (unsigned i = 0; i != nprocesses_; ++i) {
+    while (wait4(pids_[i], &statuses[i], 0, &usages[i]) < 0) {
+      if (errno != EINTR) {
+        throw Exception{errors::EventProcessorFailure}
+          << "Unable to wait for worker process " << i << " (pid " << pids_[i]
+          << "): " << std::strerror(errno) << ".\n";
+      }
+    }
+  }
+
+  cet::HorizontalRule const rule{60};
+  std::ostringstream summary;
+  summary << rule('=') << '\n'
+          << "Worker  pid       CPU time [s]  Result\n"
+          << rule('-') << '\n';
+  unsigned nfailed{};
+  for (unsigned i = 0; i != nprocesses_; ++i) {
+    auto const& usage = usages[i];
+    auto const cpu = seconds(usage.ru_utime) + seconds(usage.ru_stime);
+    bool const ok = WIFEXITED(statuses[i]) && WEXITSTATUS(statuses[i]) == 0;
+    nfailed += !ok;
+    summary << std::left << std::setw(8) << i << std::setw(10) << pids_[i]
+            << std::setw(14) << std::fixed << std::setprecision(2) << cpu
+            << describe(statuses[i]) << '\n';
+  }
+  summary << rule('=');
+  mf::LogAbsolute("WorkerProcesses") << summary.str();
+
+  if (nfailed != 0) {
+    throw Exception{errors::EventProcessorFailure}
+      << nfailed << " of " << nprocesses_
+      << " worker processes did not complete successfully.\n";
+  }
+}
@@ -0,0 +1,63 @@
+#ifndef art_Framework_EventProcessor_detail_WorkerProcesses_h
+#define art_Framework_EventProcessor_detail_WorkerProcesses_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+//
+// WorkerProcesses - Forks the worker processes of a multi-process job
+// (services.scheduler.num_processes > 1) and, in the original
+// process, waits for them to finish.
+//
+// The constructor returns once in the original (parent) process and
+// once in each of the workers.  A worker uses ownsNextSubRun() to
+// decide whether it should process the next subrun presented by the
+// input source: worker i processes subruns i, i+n, i+2n, ... in input
+// order.  The parent calls waitForWorkers(), which reports the exit
+// status and CPU time of each worker, and throws if any of them
+// failed.
+//
+// No other threads may be running when the constructor is called, as
+// they are not replicated in the workers, and no files other than the
+// standard streams may be open for reading, as the workers would share
+// their file offsets.  On Linux, the constructor checks both and
+// throws a Configuration exception otherwise.
+//
+// ======================================================================
+
+#include <sys/types.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace art::detail {
+  class WorkerProcesses {
+  public:
+    explicit WorkerProcesses(unsigned nprocesses);
+
+    bool
+    isParent() const noexcept
+    {
+      return !index_.has_value();
+    }
+
+    // Worker only
+    unsigned index() const;
+    bool ownsNextSubRun() noexcept;
+
+    // Parent only
+    void waitForWorkers();
+
+  private:
+    unsigned const nprocesses_;
+    std::optional<unsigned> index_{};
+    std::vector<pid_t> pids_{};
+    std::size_t subRunsSeen_{};
+  };
+}
+
+#endif /* art_Framework_EventProcessor_detail_WorkerProcesses_h */
+
+// Local Variables:
+// mode: c++
+// End:
@@ -0,0 +1,98 @@
+#include "art/Framework/IO/Catalog/FilePrefetcher.h"
+
+#include <chrono>
+#include <iterator>
+#include <utility>
+
+namespace art {
+
+  FilePrefetcher::FilePrefetcher(std::size_t const depth, fetch_t fetch)
+    : depth_{depth}, fetch_{std::move(fetch)}, thread_{[this] { run_(); }}
+  {}
+
+  FilePrefetcher::~FilePrefetcher()
+  {
+    stop();
+  }
+
+  FilePrefetcher::Item
+  FilePrefetcher::next()
+  {
+    std::unique_lock lock{mutex_};
+    cv_.wait(lock, [this] { return stopping_ || !items_.empty(); });
+    if (items_.empty()) {
+      Item result;
+      result.uriStatus = FileDeliveryStatus::NO_MORE_FILES;
+      return result;
+    }
+    if (exhausted_ && items_.size() == 1) {
+      // The final item is sticky.
+      return items_.front();
+    }
+    auto result = std::move(items_.front());
+    items_.pop_front();
+    cv_.notify_all();
+    return result;
+  }
+
+  std::vector<FilePrefetcher::Item>
+  FilePrefetcher::stop()
+  {
+    {
+      std::lock_guard lock{mutex_};
+      stopping_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+    std::vector<Item> result(std::make_move_iterator(items_.begin()),
+                             std::make_move_iterator(items_.end()));
+    items_.clear();
+    return result;
+  }
+
+  void
+  FilePrefetcher::run_()
+  {
+    pause_t const pause{[this](double const seconds) {
+      return pause_(seconds);
+    }};
+    std::unique_lock lock{mutex_};
+    while (true) {
+      cv_.wait(lock, [this] { return stopping_ || items_.size() < depth_; });
+      if (stopping_) {
+        return;
+      }
+      lock.unlock();
+      Item item;
+      try {
+        fetch_(item, pause);
+      }
+      catch (...) {
+        item.error = std::current_exception();
+      }
+      lock.lock();
+      bool const last =
+        item.error || item.uriStatus == FileDeliveryStatus::NO_MORE_FILES;
+      // An item fetched while stopping is kept so that its disposition
+      // can still be reported.
+      items_.push_back(std::move(item));
+      cv_.notify_all();
+      if (last) {
+        exhausted_ = true;
+        return;
+      }
+    }
+  }
+
+  bool
+  FilePrefetcher::pause_(double const seconds)
+  {
+    std::unique_lock lock{mutex_};
+    return !cv_.wait_for(lock, std::chrono::duration<double>(seconds), [this] {
+      return stopping_;
+    });
+  }
+
+} // namespace art
@@ -0,0 +1,91 @@
+#ifndef art_Framework_IO_Catalog_FilePrefetcher_h
+#define art_Framework_IO_Catalog_FilePrefetcher_h
+
+// ======================================================================
+//
+// Class FilePrefetcher.  Obtains input files ahead of their use.
+//
+// A dedicated thread repeatedly calls the supplied fetch function,
+// which is expected to ask the CatalogInterface service for the next
+// URI and the FileTransfer service for a local copy of it.  Up to
+// 'depth' such files are kept ready so that, while file k is being
+// processed, files k+1...k+depth are being delivered and staged.
+//
+// Fetching stops once an item with a NO_MORE_FILES delivery status is
+// produced, or once the fetch function throws; that item is then
+// returned by every subsequent call to next().  An exception thrown by
+// the fetch function is recorded in the item's 'error' member for the
+// consumer to rethrow.
+//
+// A fetch function that must wait between attempts should do so by
+// calling the supplied pause function, which returns false (possibly
+// before the requested time has elapsed) once the prefetcher is being
+// stopped.
+//
+// ======================================================================
+
+#include "art/Framework/Services/FileServiceInterfaces/FileDeliveryStatus.h"
+#include "art/Framework/Services/FileServiceInterfaces/FileTransferStatus.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace art {
+
+  class FilePrefetcher {
+  public:
+    struct Item {
+      std::string uri{};
+      std::string pfn{};
+      FileDeliveryStatus uriStatus{FileDeliveryStatus::PENDING};
+      FileTransferStatus ftStatus{FileTransferStatus::PENDING};
+      std::exception_ptr error{};
+    };
+
+    using pause_t = std::function<bool(double seconds)>;
+    using fetch_t = std::function<void(Item&, pause_t const&)>;
+
+    FilePrefetcher(std::size_t depth, fetch_t fetch);
+    ~FilePrefetcher();
+
+    FilePrefetcher(FilePrefetcher const&) = delete;
+    FilePrefetcher& operator=(FilePrefetcher const&) = delete;
+
+    // Blocks until the next file is available.
+    Item next();
+
+    // Stops the fetching thread and returns the items that have been
+    // fetched (or were being fetched) but not yet taken, so that their
+    // disposition can be reported to the CatalogInterface service.
+    std::vector<Item> stop();
+
+  private:
+    void run_();
+    bool pause_(double seconds);
+
+    std::size_t const depth_;
+    fetch_t const fetch_;
+    std::mutex mutex_{};
+    std::condition_variable cv_{};
+    std::deque<Item> items_{};
+    bool stopping_{false};
+    bool exhausted_{false};
+    std::thread thread_;
+  };
+
+} // namespace art
+
+// ======================================================================
+
+#endif /* art_Framework_IO_Catalog_FilePrefetcher_h */
+
+// Local Variables:
+// mode: c++
+// End:
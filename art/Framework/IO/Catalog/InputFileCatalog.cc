@@ -14,6 +14,8 @@
 #include "cetlib_except/exception.h"
 
 #include <cassert>
+#include <exception>
+#include <utility>
 
 namespace art {
 
@@ -35,6 +37,35 @@ namespace art {
 
     if (searchable_)
       fileCatalogItems_.resize(fileSources_.size());
+
+    if (auto const depth = config().prefetchFiles(); depth > 0) {
+      // One attempt per file: the retry policy is applied by
+      // retrieveNextFile() as the files are taken.
+      prefetcher_ = std::make_unique<FilePrefetcher>(
+        depth,
+        [this](FilePrefetcher::Item& item, FilePrefetcher::pause_t const&) {
+          double wait = 0.0;
+          item.uriStatus = static_cast<FileDeliveryStatus>(
+            ci_->getNextFileURI(item.uri, wait));
+          if (item.uriStatus == FileDeliveryStatus::SUCCESS) {
+            item.ftStatus = static_cast<FileTransferStatus>(
+              ft_->translateToLocalFilename(item.uri, item.pfn));
+          }
+        });
+    }
+  }
+
+  InputFileCatalog::~InputFileCatalog()
+  {
+    if (!prefetcher_) {
+      return;
+    }
+    // Files that were delivered ahead of time but never opened.
+    for (auto const& item : prefetcher_->stop()) {
+      if (item.uriStatus == FileDeliveryStatus::SUCCESS) {
+        ci_->updateStatus(item.uri, FileDisposition::SKIPPED);
+      }
+    }
   }
 
   FileCatalogItem const&
@@ -158,6 +189,19 @@ namespace art {
       return FileCatalogStatus::SUCCESS;
     }
 
+    if (prefetcher_) {
+      auto const next = prefetcher_->next();
+      if (next.error) {
+        std::rethrow_exception(next.error);
+      }
+      if (next.uriStatus == FileDeliveryStatus::NO_MORE_FILES)
+        return FileCatalogStatus::NO_MORE_FILES;
+      if (next.uriStatus != FileDeliveryStatus::SUCCESS)
+        return FileCatalogStatus::DELIVERY_ERROR;
+      item = FileCatalogItem("", "", next.uri);
+      return recordTransfer(item, next.ftStatus, next.pfn);
+    }
+
     // Try to get it from the service
     std::string uri;
     double wait = 0.0;
@@ -182,7 +226,14 @@ namespace art {
   {
     std::string pfn;
     int const result = ft_->translateToLocalFilename(item.uri(), pfn);
+    return recordTransfer(item, result, std::move(pfn));
+  }
 
+  FileCatalogStatus
+  InputFileCatalog::recordTransfer(FileCatalogItem& item,
+                                   int const result,
+                                   std::string pfn) const
+  {
     if (result != FileTransferStatus::SUCCESS) {
       item.fileName("");
       item.logicalFileName("");
@@ -8,12 +8,15 @@
 // ======================================================================
 
 #include "art/Framework/IO/Catalog/FileCatalog.h"
+#include "art/Framework/IO/Catalog/FilePrefetcher.h"
 #include "art/Framework/Services/FileServiceInterfaces/CatalogInterface.h"
 #include "art/Framework/Services/FileServiceInterfaces/FileTransfer.h"
 #include "art/Framework/Services/Registry/ServiceHandle.h"
+#include "fhiclcpp/types/Atom.h"
 #include "fhiclcpp/types/Sequence.h"
 #include "fhiclcpp/types/TableFragment.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -31,10 +34,16 @@ namespace art {
   public:
     struct Config {
       fhicl::Sequence<std::string> namesParameter{fhicl::Name("fileNames")};
+      fhicl::Atom<std::size_t> prefetchFiles{
+        fhicl::Name("prefetchFiles"),
+        fhicl::Comment(
+          "The number of input files to deliver and transfer on a background\n"
+          "thread ahead of their use."),
+        0};
     };
 
     explicit InputFileCatalog(fhicl::TableFragment<Config> const& config);
-    virtual ~InputFileCatalog() = default;
+    virtual ~InputFileCatalog();
     std::size_t
     size() const noexcept
     {
@@ -71,6 +80,9 @@ namespace art {
                           bool transferOnly = false);
     FileCatalogStatus retrieveNextFileFromCacheOrService(FileCatalogItem& item);
     FileCatalogStatus transferNextFile(FileCatalogItem& item);
+    FileCatalogStatus recordTransfer(FileCatalogItem& item,
+                                     int result,
+                                     std::string pfn) const;
 
     std::vector<std::string> fileSources_;
     std::vector<FileCatalogItem> fileCatalogItems_{{}}; // seed with one item
@@ -83,6 +95,7 @@ namespace art {
 
     ServiceHandle<CatalogInterface> ci_;
     ServiceHandle<FileTransfer> ft_;
+    std::unique_ptr<FilePrefetcher> prefetcher_{nullptr};
   }; // InputFileCatalog
 
 } // namespace art
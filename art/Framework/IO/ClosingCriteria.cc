@@ -2,6 +2,10 @@
 #include "canvas/Utilities/Exception.h"
 // vim: set sw=2 expandtab :
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
 using namespace std;
 
 using EntryNumber_t = art::FileIndex::EntryNumber_t;
@@ -13,6 +17,15 @@ namespace {
     if (!cond)
       throw art::Exception(art::errors::Configuration) << msg << '\n';
   }
+
+  uint64_t
+  bytes_remaining(art::FileProperties const& limits,
+                  art::OutputByteCounts const& bytes)
+  {
+    auto const max_bytes = uint64_t{limits.size()} * 1024u;
+    auto const written = bytes.compressed();
+    return written < max_bytes ? max_bytes - written : 0;
+  }
 }
 
 namespace art {
@@ -282,4 +295,38 @@ namespace art {
            (fp.age() >= closingCriteria_.age());
   }
 
+  bool
+  ClosingCriteria::should_close(FileProperties const& fp,
+                                OutputByteCounts const& bytes) const
+  {
+    return should_close(fp) ||
+           bytes_remaining(closingCriteria_, bytes) <=
+             bytes.meanCompressed(InEvent);
+  }
+
+  optional<unsigned>
+  ClosingCriteria::eventsUntilClose(FileProperties const& fp,
+                                    OutputByteCounts const& bytes) const
+  {
+    optional<unsigned> result;
+    auto const maxEvents = closingCriteria_.nEvents();
+    if (maxEvents != Defaults::unsigned_max()) {
+      result = maxEvents > fp.nEvents() ? maxEvents - fp.nEvents() : 0u;
+    }
+    auto const mean = bytes.meanCompressed(InEvent);
+    if (mean > 0. && closingCriteria_.size() != Defaults::size_max()) {
+      // Consistent with should_close: no further event is expected
+      // once the remaining space is no larger than the mean event.
+      auto const remaining = bytes_remaining(closingCriteria_, bytes);
+      auto const n =
+        remaining == 0 ?
+          0. :
+          min(ceil(remaining / mean) - 1.,
+              static_cast<double>(Defaults::unsigned_max()));
+      auto const bySize = static_cast<unsigned>(n);
+      result = result ? min(*result, bySize) : bySize;
+    }
+    return result;
+  }
+
 } // namespace art
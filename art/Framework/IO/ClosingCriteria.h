@@ -2,6 +2,7 @@
 #define art_Framework_IO_ClosingCriteria_h
 // vim: set sw=2 expandtab :
 
+#include "art/Framework/Core/OutputByteCounts.h"
 #include "art/Framework/Core/OutputFileGranularity.h"
 #include "art/Framework/Core/OutputFileStatus.h"
 #include "canvas/Persistency/Provenance/FileIndex.h"
@@ -11,6 +12,7 @@
 #include <atomic>
 #include <chrono>
 #include <limits>
+#include <optional>
 #include <string>
 
 namespace art {
@@ -139,6 +141,15 @@ namespace art {
     FileProperties const& fileProperties() const;
     Granularity granularity() const;
     bool should_close(FileProperties const&) const;
+    // As above, but also using the bytes reported by the output
+    // module: the file is to be closed as soon as writing one more
+    // event of the average size would reach maxSize.
+    bool should_close(FileProperties const&, OutputByteCounts const&) const;
+    // The number of events that are expected to be written before
+    // should_close returns true, based on maxEvents and on the average
+    // compressed event size; std::nullopt if neither limit applies.
+    std::optional<unsigned> eventsUntilClose(FileProperties const&,
+                                             OutputByteCounts const&) const;
 
   private:
     FileProperties closingCriteria_;
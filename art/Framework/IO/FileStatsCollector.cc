@@ -19,7 +19,8 @@ art::FileStatsCollector::recordFileOpen()
 {
   resetStatistics_();
   if (!inputFilesSeen_.empty()) {
-    inputFilesSeen_.emplace_back(lastOpenedInputFile_);
+    auto const& name = *inputFileNames_.insert(lastOpenedInputFile_).first;
+    inputFilesSeen_.push_back(&name);
   }
   fo_ = now();
   fileCloseRecorded_ = false;
@@ -29,7 +30,8 @@ void
 art::FileStatsCollector::recordInputFile(std::string const& inputFileName)
 {
   if (!inputFileName.empty()) {
-    inputFilesSeen_.emplace_back(inputFileName);
+    auto const& name = *inputFileNames_.insert(inputFileName).first;
+    inputFilesSeen_.push_back(&name);
   }
   lastOpenedInputFile_ = inputFileName;
 }
@@ -86,7 +88,7 @@ art::FileStatsCollector::recordSubRun(SubRunID const& id)
     highestSubRun_ = id;
     highestSubRunStartTime_ = now();
   }
-  subRunsSeen_.emplace(id);
+  subRunsSeen_.insert(id);
 }
 
 void
@@ -100,14 +102,14 @@ std::vector<std::string>
 art::FileStatsCollector::parents(bool const want_basename) const
 {
   std::vector<std::string> result;
-  if (want_basename) {
-    result.reserve(inputFilesSeen_.size());
-    for (auto const& ifile : inputFilesSeen_) {
-      boost::filesystem::path const ifp{ifile};
+  result.reserve(inputFilesSeen_.size());
+  for (auto const* ifile : inputFilesSeen_) {
+    if (want_basename) {
+      boost::filesystem::path const ifp{*ifile};
       result.emplace_back(ifp.filename().native());
+    } else {
+      result.emplace_back(*ifile);
     }
-  } else {
-    result = inputFilesSeen_;
   }
   return result;
 }
@@ -7,14 +7,15 @@
 // filename itself--that is the role of the PostCloseFileRenamer.
 //===============================================================
 
+#include "art/Framework/IO/detail/SubRunRanges.h"
 #include "boost/date_time/posix_time/posix_time_types.hpp"
 #include "canvas/Persistency/Provenance/EventID.h"
 #include "canvas/Persistency/Provenance/RunID.h"
 #include "canvas/Persistency/Provenance/SubRunID.h"
 
 #include <cstddef> // For std::size_t.
-#include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace art {
@@ -51,7 +52,7 @@ public:
   std::vector<std::string> parents(bool want_basename = true) const;
   bool fileCloseRecorded() const;
   std::size_t eventsThisFile() const;
-  std::set<SubRunID> const& seenSubRuns() const;
+  detail::SubRunRanges const& seenSubRuns() const;
 
 private:
   void resetStatistics_(); // Does not rename.
@@ -72,9 +73,12 @@ private:
   boost::posix_time::ptime highestSubRunStartTime_{};
   bool fileCloseRecorded_{false};
   std::string lastOpenedInputFile_{};
-  std::vector<std::string> inputFilesSeen_{};
+  // Each input-file name is stored once for the job; the files read
+  // for the current output file refer to those names.
+  std::unordered_set<std::string> inputFileNames_{};
+  std::vector<std::string const*> inputFilesSeen_{};
   std::size_t nEvents_{};
-  std::set<SubRunID> subRunsSeen_{};
+  detail::SubRunRanges subRunsSeen_{};
 };
 
 inline std::string const&
@@ -179,7 +183,7 @@ art::FileStatsCollector::eventsThisFile() const
   return nEvents_;
 }
 
-inline std::set<art::SubRunID> const&
+inline art::detail::SubRunRanges const&
 art::FileStatsCollector::seenSubRuns() const
 {
   return subRunsSeen_;
@@ -79,6 +79,25 @@
 //
 //      void closeCurrentFile();
 //
+//    * If the source is configured with an event list (the
+//    'eventList' and 'eventListFile' parameters), only the listed
+//    events, and the runs and subruns containing them, are delivered;
+//    everything else returned by readNext is discarded.  A detail class
+//    whose files are ordered by EventID (e.g. one with a FileIndex) may
+//    also provide the *optional* function:
+//
+//      bool seekEvent(art::EventID const& id);
+//
+//    which positions the reader so that the next call to readNext
+//    returns the first event in the current file that is not before
+//    id--together with its run and subrun, if they differ from the
+//    ones passed to readNext--and returns false if there is no such
+//    event.  It is called before each readNext, so that unselected
+//    runs, subruns and events are never read.  It is also used to skip
+//    subruns without reading their events (as the worker processes of
+//    a multi-process job do), unless maxEvents is set, as skipped
+//    events must then be counted.
+//
 // ======================================================================
 
 #include "art/Framework/Core/FileBlock.h"
@@ -90,6 +109,7 @@
 #include "art/Framework/Core/fwd.h"
 #include "art/Framework/IO/Sources/SourceHelper.h"
 #include "art/Framework/IO/Sources/SourceTraits.h"
+#include "art/Framework/IO/Sources/detail/EventList.h"
 #include "art/Framework/IO/Sources/detail/FileNamesHandler.h"
 #include "art/Framework/Principal/EventPrincipal.h"
 #include "art/Framework/Principal/OpenRangeSetHandler.h"
@@ -110,6 +130,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <type_traits>
 
 namespace art {
@@ -169,6 +190,15 @@ namespace art {
       }
     };
 
+    template <typename T, typename = void>
+    struct has_seekEvent : std::false_type {};
+
+    template <typename T>
+    struct has_seekEvent<
+      T,
+      cet::enable_if_function_exists_t<bool (T::*)(EventID const&),
+                                       &T::seekEvent>> : std::true_type {};
+
     ////////////////////////////////////////////////////////////////////
     // Does the detail object have a Parameters type?
     template <typename T, typename = void>
@@ -186,6 +216,28 @@ namespace art {
           fhicl::Sequence<std::string> fileNames{fhicl::Name("fileNames"), {}};
           fhicl::Atom<int64_t> maxSubRuns{fhicl::Name("maxSubRuns"), -1};
           fhicl::Atom<int64_t> maxEvents{fhicl::Name("maxEvents"), -1};
+          fhicl::Atom<std::size_t> prefetchFiles{
+            fhicl::Name("prefetchFiles"),
+            fhicl::Comment(
+              "The number of input files to deliver and transfer ahead of\n"
+              "their use.  It is ignored unless the source uses the file\n"
+              "delivery and transfer services."),
+            0};
+          fhicl::Sequence<std::string> eventList{
+            fhicl::Name("eventList"),
+            fhicl::Comment(
+              "The events to process, each given as\n"
+              "\"<run>:<subrun>:<event>\".  All other events, and the runs\n"
+              "and subruns that contain none of the listed events, are\n"
+              "skipped.  If neither this nor eventListFile is specified, all\n"
+              "events are processed."),
+            {}};
+          fhicl::Atom<std::string> eventListFile{
+            fhicl::Name("eventListFile"),
+            fhicl::Comment(
+              "A file of events to process, one \"<run>:<subrun>:<event>\"\n"
+              "per line, in addition to those in eventList."),
+            ""};
         };
         fhicl::TableFragment<SourceConfig> sourceConfig;
         user_config_t userConfig;
@@ -231,6 +283,9 @@ namespace art {
     std::unique_ptr<EventPrincipal> readEvent(
       cet::exempt_ptr<SubRunPrincipal const> srp) override;
 
+    input::ItemType skipSubRun(
+      cet::exempt_ptr<RunPrincipal const> rp) override;
+
     std::unique_ptr<RangeSetHandler> runRangeSetHandler() override;
     std::unique_ptr<RangeSetHandler> subRunRangeSetHandler() override;
 
@@ -274,6 +329,11 @@ namespace art {
     input::ItemType state_{input::IsInvalid};
     detail::FileNamesHandler<Source_wantFileServices<T>::value> fh_;
     std::string currentFileName_{};
+    detail::EventList eventList_;
+    // The last event read from the current file, for seeking.
+    std::optional<EventID> lastEvent_{};
+    // The event to seek to after skipping a subrun.
+    std::optional<EventID> skipTo_{};
 
     std::unique_ptr<RunPrincipal> newRP_{};
     std::unique_ptr<SubRunPrincipal> newSRP_{};
@@ -302,7 +362,10 @@ namespace art {
     , outputCallbacks_{d.productRegistry}
     , sourceHelper_{d.moduleDescription}
     , detail_{p, h_, sourceHelper_}
-    , fh_{p.template get<std::vector<std::string>>("fileNames", {})}
+    , fh_{p.template get<std::vector<std::string>>("fileNames", {}),
+          p.template get<std::size_t>("prefetchFiles", 0)}
+    , eventList_{p.template get<std::vector<std::string>>("eventList", {}),
+                 p.template get<std::string>("eventListFile", {})}
   {
     int64_t const maxSubRuns_par = p.template get<int64_t>("maxSubRuns", -1);
     if (maxSubRuns_par > -1) {
@@ -326,7 +389,9 @@ namespace art {
     , outputCallbacks_{d.productRegistry}
     , sourceHelper_{d.moduleDescription}
     , detail_{p().userConfig, h_, sourceHelper_}
-    , fh_{p().sourceConfig().fileNames()}
+    , fh_{p().sourceConfig().fileNames(), p().sourceConfig().prefetchFiles()}
+    , eventList_{p().sourceConfig().eventList(),
+                 p().sourceConfig().eventListFile()}
   {
     if (int64_t const maxSubRuns_par = p().sourceConfig().maxSubRuns();
         maxSubRuns_par > -1) {
@@ -458,7 +523,17 @@ namespace art {
     std::unique_ptr<SubRunPrincipal> newSR{nullptr};
     std::unique_ptr<EventPrincipal> newE{nullptr};
     bool result{false};
-    {
+    do {
+      if constexpr (detail::has_seekEvent<T>::value) {
+        if (eventList_ || skipTo_) {
+          auto const next =
+            eventList_ ? eventList_.nextAfter(lastEvent_) : skipTo_;
+          skipTo_.reset();
+          if (!next || !detail_.seekEvent(*next)) {
+            return false; // Nothing more to read from this file.
+          }
+        }
+      }
       RunPrincipal* nR{nullptr};
       SubRunPrincipal* nSR{nullptr};
       EventPrincipal* nE{nullptr};
@@ -467,7 +542,24 @@ namespace art {
       newSR.reset(nSR);
       newE.reset(nE);
       throwIfInsane_(result, newR.get(), newSR.get(), newE.get());
-    }
+      if (!result || !eventList_) {
+        break;
+      }
+      // Discard whatever is not selected, and read on if that is
+      // everything.
+      if (newE) {
+        lastEvent_ = newE->eventID();
+        if (!eventList_.wants(newE->eventID())) {
+          newE.reset();
+        }
+      }
+      if (newSR && !eventList_.wants(newSR->subRunID())) {
+        newSR.reset();
+      }
+      if (newR && !eventList_.wants(newR->runID())) {
+        newR.reset();
+      }
+    } while (!newR && !newSR && !newE);
     if (result) {
       subRunIsNew_ =
         newSR && ((!cachedSRP_) || newSR->subRunID() != cachedSRP_->subRunID());
@@ -522,7 +614,7 @@ namespace art {
   input::ItemType
   Source<T>::nextItemType()
   {
-    if (remainingEvents_ == 0) {
+    if (remainingEvents_ == 0 || eventList_.done()) {
       state_ = input::IsStop;
     }
     switch (state_) {
@@ -637,6 +729,8 @@ namespace art {
   Source<T>::readFile()
   {
     FileBlock* newF{nullptr};
+    lastEvent_.reset();
+    skipTo_.reset();
     detail_.readFile(currentFileName_, newF);
     if (!newF) {
       throw Exception(errors::LogicError)
@@ -695,9 +789,35 @@ namespace art {
     if (haveEventLimit_) {
       --remainingEvents_;
     }
+    eventList_.delivered(newE_->eventID());
     return std::move(newE_);
   }
 
+  template <typename T>
+  input::ItemType
+  Source<T>::skipSubRun(cet::exempt_ptr<RunPrincipal const> const rp)
+  {
+    if constexpr (detail::has_seekEvent<T>::value) {
+      if (!haveEventLimit_) {
+        auto const id = readSubRun(rp)->subRunID();
+        // Any event read together with the subrun is dropped, and the
+        // detail seeks past the subrun's remaining events.
+        newE_.reset();
+        pendingEvent_ = false;
+        eventList_.skipped(id);
+        lastEvent_ = EventID{id, IDNumber<Level::Event>::max_valid()};
+        skipTo_ = EventID::firstEvent(id.next());
+        cachedSRP_ = nullptr;
+        state_ = input::IsEvent;
+        return nextItemType();
+      }
+    }
+    auto const result = InputSource::skipSubRun(rp);
+    // The skipped subrun's principal no longer exists.
+    cachedSRP_ = nullptr;
+    return result;
+  }
+
   template <typename T>
   void
   Source<T>::finishProductRegistration_(InputSourceDescription& d)
@@ -3,7 +3,7 @@
 #include "art/Framework/Principal/EventPrincipal.h"
 #include "art/Framework/Principal/RunPrincipal.h"
 #include "art/Framework/Principal/SubRunPrincipal.h"
-#include "art/Persistency/Provenance/ProcessHistoryRegistry.h"
+#include "art/Persistency/Provenance/ProcessHistoryCache.h"
 #include "canvas/Persistency/Provenance/ProductTables.h"
 #include "canvas/Persistency/Provenance/RunAuxiliary.h"
 #include "canvas/Persistency/Provenance/SubRunAuxiliary.h"
@@ -42,24 +42,17 @@ art::SourceHelper::updatedProcessHistoryID_(
     return processHistoryID;
   }
 
-  art::ProcessHistory processHistory{};
-  if (processHistoryID.isValid()) {
-    bool const found =
-      ProcessHistoryRegistry::get(processHistoryID, processHistory);
-    if (!found) {
-      throw Exception(
-        errors::LogicError,
-        "Error while attempting to create principal from SourceHelper.\n")
-        << "The provided process-history ID\n"
-        << "  " << processHistory << '\n'
-        << "does not correspond to a known process history.\n"
-           "Please contact artists@fnal.gov for guidance.";
-    }
+  auto const processHistory = ProcessHistoryCache::get(processHistoryID);
+  if (processHistory == nullptr) {
+    throw Exception(
+      errors::LogicError,
+      "Error while attempting to create principal from SourceHelper.\n")
+      << "The provided process-history ID\n"
+      << "  " << processHistoryID << '\n'
+      << "does not correspond to a known process history.\n"
+         "Please contact artists@fnal.gov for guidance.";
   }
-  processHistory.push_back(pc);
-  auto const phid = processHistory.id();
-  art::ProcessHistoryRegistry::emplace(phid, processHistory);
-  return phid;
+  return ProcessHistoryCache::extend(*processHistory, pc).id();
 }
 
 void
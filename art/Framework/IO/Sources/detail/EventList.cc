@@ -0,0 +1,144 @@
+#include "art/Framework/IO/Sources/detail/EventList.h"
+// vim: set sw=2 expandtab :
+
+#include "canvas/Persistency/Provenance/IDNumber.h"
+#include "canvas/Utilities/Exception.h"
+
+#include <fstream>
+#include <regex>
+
+namespace {
+
+  std::regex const re_event_id{R"(\s*(\d+)\s*:\s*(\d+)\s*:\s*(\d+)\s*)"};
+
+  template <art::Level L>
+  bool
+  in_range(std::string const& field, art::IDNumber_t<L>& result)
+  {
+    unsigned long long num{};
+    try {
+      num = std::stoull(field);
+    }
+    catch (std::out_of_range const&) {
+      return false;
+    }
+    if (num < art::IDNumber<L>::first() ||
+        num > art::IDNumber<L>::max_valid()) {
+      return false;
+    }
+    result = static_cast<art::IDNumber_t<L>>(num);
+    return true;
+  }
+
+} // namespace
+
+art::detail::EventList::EventList(std::vector<std::string> const& specs,
+                                  std::string const& filename)
+  : active_{!specs.empty() || !filename.empty()}
+{
+  for (auto const& spec : specs) {
+    add_(spec, "source.eventList");
+  }
+  if (filename.empty()) {
+    return;
+  }
+  std::ifstream is{filename};
+  if (!is) {
+    throw Exception(errors::Configuration)
+      << "The event-list file \"" << filename << "\" cannot be read.\n";
+  }
+  unsigned lineNumber{};
+  for (std::string line; std::getline(is, line);) {
+    ++lineNumber;
+    auto const first = line.find_first_not_of(" \t");
+    if (first == std::string::npos || line[first] == '#') {
+      continue;
+    }
+    add_(line, filename + ':' + std::to_string(lineNumber));
+  }
+}
+
+art::detail::EventList::operator bool() const noexcept
+{
+  return active_;
+}
+
+bool
+art::detail::EventList::done() const noexcept
+{
+  return active_ && remaining_.empty();
+}
+
+bool
+art::detail::EventList::wants(RunID const& id) const
+{
+  if (!active_) {
+    return true;
+  }
+  auto const it =
+    remaining_.lower_bound(EventID::firstEvent(SubRunID::firstSubRun(id)));
+  return it != remaining_.cend() && it->runID() == id;
+}
+
+bool
+art::detail::EventList::wants(SubRunID const& id) const
+{
+  if (!active_) {
+    return true;
+  }
+  auto const it = remaining_.lower_bound(EventID::firstEvent(id));
+  return it != remaining_.cend() && it->subRunID() == id;
+}
+
+bool
+art::detail::EventList::wants(EventID const& id) const
+{
+  return !active_ || remaining_.count(id) != 0;
+}
+
+std::optional<art::EventID>
+art::detail::EventList::nextAfter(std::optional<EventID> const& id) const
+{
+  auto const it = id ? remaining_.upper_bound(*id) : remaining_.cbegin();
+  if (it == remaining_.cend()) {
+    return std::nullopt;
+  }
+  return *it;
+}
+
+void
+art::detail::EventList::delivered(EventID const& id)
+{
+  remaining_.erase(id);
+}
+
+void
+art::detail::EventList::skipped(SubRunID const& id)
+{
+  auto const begin = remaining_.lower_bound(EventID::firstEvent(id));
+  auto end = begin;
+  while (end != remaining_.cend() && end->subRunID() == id) {
+    ++end;
+  }
+  remaining_.erase(begin, end);
+}
+
+void
+art::detail::EventList::add_(std::string const& spec,
+                             std::string const& context)
+{
+  std::smatch parts;
+  RunNumber_t run{};
+  SubRunNumber_t subRun{};
+  EventNumber_t event{};
+  if (!std::regex_match(spec, parts, re_event_id) ||
+      !in_range<Level::Run>(parts[1], run) ||
+      !in_range<Level::SubRun>(parts[2], subRun) ||
+      !in_range<Level::Event>(parts[3], event)) {
+    throw Exception(errors::Configuration)
+      << context << ": the specification '" << spec
+      << "' is not a valid EventID.\n"
+      << "Please specify a value of the form '<run>:<subrun>:<event>'.\n";
+  }
+  remaining_.emplace(run, subRun, event);
+}
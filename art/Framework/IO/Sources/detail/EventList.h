@@ -0,0 +1,67 @@
+#ifndef art_Framework_IO_Sources_detail_EventList_h
+#define art_Framework_IO_Sources_detail_EventList_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// EventList
+//
+// The events selected for processing by a Source<T>'s 'eventList' and
+// 'eventListFile' parameters, each given as "<run>:<subrun>:<event>".
+// The file holds one such specification per line; blank lines and
+// lines starting with '#' are ignored.
+//
+// An empty specification selects all events.  Otherwise, events are
+// removed from the list as they are delivered, so that the source can
+// stop as soon as the last selected event has been read.
+// ======================================================================
+
+#include "canvas/Persistency/Provenance/EventID.h"
+#include "canvas/Persistency/Provenance/RunID.h"
+#include "canvas/Persistency/Provenance/SubRunID.h"
+
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace art::detail {
+
+  class EventList {
+  public:
+    EventList(std::vector<std::string> const& specs,
+              std::string const& filename);
+
+    // False if all events are selected.
+    explicit operator bool() const noexcept;
+
+    // True once every selected event has been delivered.
+    bool done() const noexcept;
+
+    bool wants(RunID const& id) const;
+    bool wants(SubRunID const& id) const;
+    bool wants(EventID const& id) const;
+
+    // The first selected event after the given one (or the first
+    // selected event, if none is given).
+    std::optional<EventID> nextAfter(std::optional<EventID> const& id) const;
+
+    void delivered(EventID const& id);
+
+    // Removes the selected events of a subrun that is skipped without
+    // being read.
+    void skipped(SubRunID const& id);
+
+  private:
+    void add_(std::string const& spec, std::string const& context);
+
+    bool active_{false};
+    std::set<EventID> remaining_{};
+  };
+
+} // namespace art::detail
+
+#endif /* art_Framework_IO_Sources_detail_EventList_h */
+
+// Local Variables:
+// mode: c++
+// End:
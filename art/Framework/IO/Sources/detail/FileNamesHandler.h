@@ -16,6 +16,7 @@ namespace art::detail {
   class FileNamesHandler<true> {
   public:
     explicit FileNamesHandler(std::vector<std::string>&& fileNames,
+                              size_t prefetchDepth = 0,
                               size_t attempts = 5,
                               double waitBetweenAttempts = 5.0);
 
@@ -44,9 +45,10 @@ namespace art::detail {
 
 art::detail::FileNamesHandler<true>::FileNamesHandler(
   std::vector<std::string>&& fileNames,
+  size_t prefetchDepth,
   size_t attempts,
   double waitBetweenAttempts)
-  : fp_(std::move(fileNames), attempts, waitBetweenAttempts)
+  : fp_(std::move(fileNames), attempts, waitBetweenAttempts, prefetchDepth)
 {}
 
 inline std::string
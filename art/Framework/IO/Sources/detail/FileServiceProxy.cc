@@ -1,15 +1,27 @@
 #include "art/Framework/IO/Sources/detail/FileServiceProxy.h"
 #include "art/Framework/Services/FileServiceInterfaces/FileDisposition.h"
+#include "canvas/Utilities/Exception.h"
+
+#include <cassert>
+#include <chrono>
+#include <exception>
+#include <thread>
 
 art::detail::FileServiceProxy::FileServiceProxy(
   std::vector<std::string>&& fileNames,
   size_t const attempts,
-  double const waitBetweenAttempts)
-  : currentItem_{attempts}
-  , attemptsPerPhase_{attempts}
-  , waitBetweenAttempts_{waitBetweenAttempts}
+  double const waitBetweenAttempts,
+  size_t const prefetchDepth)
+  : attemptsPerPhase_{attempts}, waitBetweenAttempts_{waitBetweenAttempts}
 {
   ci_->configure(std::move(fileNames));
+  if (prefetchDepth > 0) {
+    prefetcher_ = std::make_unique<FilePrefetcher>(
+      prefetchDepth,
+      [this](FileEntity& item, FilePrefetcher::pause_t const& pause) {
+        obtainURI_(item, pause);
+      });
+  }
 }
 
 art::detail::FileServiceProxy::~FileServiceProxy()
@@ -21,6 +33,36 @@ art::detail::FileServiceProxy::~FileServiceProxy()
       ci_->updateStatus(currentItem_.uri, FileDisposition::SKIPPED);
     }
   }
+  if (prefetcher_) {
+    // Files that were delivered ahead of time but never opened.
+    for (auto const& item : prefetcher_->stop()) {
+      if (!item.uri.empty() &&
+          item.uriStatus == FileDeliveryStatus::SUCCESS) {
+        ci_->updateStatus(item.uri, FileDisposition::SKIPPED);
+      }
+    }
+  }
+}
+
+std::string
+art::detail::FileServiceProxy::next()
+{
+  finish();
+  if (prefetcher_) {
+    currentItem_ = prefetcher_->next();
+    if (currentItem_.error) {
+      std::rethrow_exception(currentItem_.error);
+    }
+  } else {
+    obtainURI_(currentItem_, [](double const seconds) {
+      std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+      return true;
+    });
+  }
+  if (currentItem_.uriStatus == FileDeliveryStatus::NO_MORE_FILES) {
+    return std::string(); // Done.
+  }
+  return currentItem_.pfn;
 }
 
 void
@@ -30,68 +72,79 @@ art::detail::FileServiceProxy::finish()
     // File is complete.
     ci_->updateStatus(currentItem_.uri, FileDisposition::CONSUMED);
   }
-  currentItem_ = FileEntity(attemptsPerPhase_);
+  currentItem_ = FileEntity{};
 }
 
-std::string
-art::detail::FileServiceProxy::obtainURI_()
+void
+art::detail::FileServiceProxy::obtainURI_(
+  FileEntity& item,
+  FilePrefetcher::pause_t const& pause) const
 {
+  size_t attemptsRemaining{attemptsPerPhase_};
   double wait = 0.0;
-  switch (currentItem_.uriStatus) {
-  case FileDeliveryStatus::TRY_AGAIN_LATER:
-    [[fallthrough]];
-  case FileDeliveryStatus::UNAVAILABLE:
-    wait = waitBetweenAttempts_;
-    [[fallthrough]];
-  case FileDeliveryStatus::PENDING:
-    if (!currentItem_.attemptsRemaining--) {
+  while (true) {
+    switch (item.uriStatus) {
+    case FileDeliveryStatus::TRY_AGAIN_LATER:
+      [[fallthrough]];
+    case FileDeliveryStatus::UNAVAILABLE:
+      wait = waitBetweenAttempts_;
+      [[fallthrough]];
+    case FileDeliveryStatus::PENDING:
+      if (!attemptsRemaining--) {
+        throw Exception(errors::CatalogServiceError)
+          << "Unable to obtain URI from CatalogInterface service after "
+          << attemptsPerPhase_ << " attempts.\n";
+      }
+      item.uriStatus = static_cast<FileDeliveryStatus>(
+        ci_->getNextFileURI(item.uri, wait));
+      break;
+    case FileDeliveryStatus::SUCCESS:
+      obtainFileFromURI_(item, pause);
+      return;
+    case FileDeliveryStatus::NO_MORE_FILES:
+      return; // Done.
+    default:
       throw Exception(errors::CatalogServiceError)
-        << "Unable to obtain URI from CatalogInterface service after "
-        << attemptsPerPhase_ << " attempts.\n";
+        << "CatalogInterface service returned failure code "
+        << translateFileDeliveryStatus(item.uriStatus) << " ("
+        << static_cast<int>(item.uriStatus) << ").\n";
     }
-    currentItem_.uriStatus = static_cast<FileDeliveryStatus>(
-      ci_->getNextFileURI(currentItem_.uri, wait));
-    return obtainURI_();
-  case FileDeliveryStatus::SUCCESS:
-    currentItem_.attemptsRemaining = attemptsPerPhase_; // Reset.
-    return obtainFileFromURI_();
-    break;
-  case FileDeliveryStatus::NO_MORE_FILES:
-    return std::string(); // Done.
-  default:
-    throw Exception(errors::CatalogServiceError)
-      << "CatalogInterface service returned failure code "
-      << translateFileDeliveryStatus(currentItem_.uriStatus) << " ("
-      << static_cast<int>(currentItem_.uriStatus) << ").\n";
   }
 }
 
-std::string
-art::detail::FileServiceProxy::obtainFileFromURI_()
+void
+art::detail::FileServiceProxy::obtainFileFromURI_(
+  FileEntity& item,
+  FilePrefetcher::pause_t const& pause) const
 {
-  assert(currentItem_.uriStatus == FileDeliveryStatus::SUCCESS);
-  switch (currentItem_.ftStatus) {
-  case FileTransferStatus::UNAVAILABLE:
-    sleep(waitBetweenAttempts_);
-    [[fallthrough]];
-  case FileTransferStatus::PENDING:
-    if (!currentItem_.attemptsRemaining--) {
+  assert(item.uriStatus == FileDeliveryStatus::SUCCESS);
+  size_t attemptsRemaining{attemptsPerPhase_};
+  while (true) {
+    switch (item.ftStatus) {
+    case FileTransferStatus::UNAVAILABLE:
+      if (!pause(waitBetweenAttempts_)) {
+        return; // Abandoned: the job is ending.
+      }
+      [[fallthrough]];
+    case FileTransferStatus::PENDING:
+      if (!attemptsRemaining--) {
+        throw Exception(errors::CatalogServiceError)
+          << "Unable to obtain URI " << item.uri
+          << " from FileTransfer service after " << attemptsPerPhase_
+          << " attempts.\n";
+      }
+      item.ftStatus = static_cast<FileTransferStatus>(
+        ft_->translateToLocalFilename(item.uri, item.pfn));
+      break;
+    case FileTransferStatus::SUCCESS:
+      ci_->updateStatus(item.uri, FileDisposition::TRANSFERRED);
+      return; // Done.
+    default:
       throw Exception(errors::CatalogServiceError)
-        << "Unable to obtain URI " << currentItem_.uri
-        << " from FileTransfer service after " << attemptsPerPhase_
-        << " attempts.\n";
+        << "FileTransfer service returned failure code "
+        << translateFileTransferStatus(item.ftStatus) << " ("
+        << static_cast<int>(item.ftStatus) << ") for URI " << item.uri
+        << ".\n";
     }
-    currentItem_.ftStatus = static_cast<FileTransferStatus>(
-      ft_->translateToLocalFilename(currentItem_.uri, currentItem_.pfn));
-    return obtainFileFromURI_();
-  case FileTransferStatus::SUCCESS:
-    ci_->updateStatus(currentItem_.uri, FileDisposition::TRANSFERRED);
-    return currentItem_.pfn; // Done.
-  default:
-    throw Exception(errors::CatalogServiceError)
-      << "FileTransfer service returned failure code "
-      << translateFileTransferStatus(currentItem_.ftStatus) << " ("
-      << static_cast<int>(currentItem_.ftStatus) << ") for URI "
-      << currentItem_.uri << ".\n";
   }
 }
@@ -1,12 +1,14 @@
 #ifndef art_Framework_IO_Sources_detail_FileServiceProxy_h
 #define art_Framework_IO_Sources_detail_FileServiceProxy_h
 
+#include "art/Framework/IO/Catalog/FilePrefetcher.h"
 #include "art/Framework/Services/FileServiceInterfaces/CatalogInterface.h"
 #include "art/Framework/Services/FileServiceInterfaces/FileDeliveryStatus.h"
 #include "art/Framework/Services/FileServiceInterfaces/FileTransfer.h"
 #include "art/Framework/Services/FileServiceInterfaces/FileTransferStatus.h"
 #include "art/Framework/Services/Registry/ServiceHandle.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -14,43 +16,36 @@ namespace art::detail {
   class FileServiceProxy;
 }
 
+// If prefetchDepth is nonzero, up to that many files are delivered
+// and transferred on a background thread while the current one is
+// being read (see FilePrefetcher.h).
 class art::detail::FileServiceProxy {
 public:
   explicit FileServiceProxy(std::vector<std::string>&& fileNames,
                             size_t attempts = 5,
-                            double waitBetweenAttempts = 5.0);
+                            double waitBetweenAttempts = 5.0,
+                            size_t prefetchDepth = 0);
   ~FileServiceProxy();
 
   std::string next();
   void finish();
 
 private:
-  std::string obtainURI_();
-  std::string obtainFileFromURI_();
+  using FileEntity = FilePrefetcher::Item;
+
+  void obtainURI_(FileEntity& item,
+                  FilePrefetcher::pause_t const& pause) const;
+  void obtainFileFromURI_(FileEntity& item,
+                          FilePrefetcher::pause_t const& pause) const;
 
   ServiceHandle<CatalogInterface> ci_{};
   ServiceHandle<FileTransfer> ft_{};
-  struct FileEntity {
-    explicit FileEntity(size_t const attempts) noexcept
-      : attemptsRemaining{attempts}
-    {}
-    std::string uri{};
-    std::string pfn{};
-    FileDeliveryStatus uriStatus{FileDeliveryStatus::PENDING};
-    FileTransferStatus ftStatus{FileTransferStatus::PENDING};
-    size_t attemptsRemaining;
-  } currentItem_;
+  FileEntity currentItem_{};
   size_t const attemptsPerPhase_;
   double const waitBetweenAttempts_;
+  std::unique_ptr<FilePrefetcher> prefetcher_{nullptr};
 };
 
-inline std::string
-art::detail::FileServiceProxy::next()
-{
-  finish();
-  return obtainURI_();
-}
-
 #endif /* art_Framework_IO_Sources_detail_FileServiceProxy_h */
 
 // Local Variables:
@@ -0,0 +1,109 @@
+#include "art/Framework/IO/detail/SubRunRanges.h"
+// vim: set sw=2 expandtab :
+
+#include <algorithm>
+
+namespace art::detail {
+
+  bool
+  SubRunRanges::insert(SubRunID const& id)
+  {
+    auto const run = id.run();
+    auto const subRun = id.subRun();
+
+    // The usual case: the next subrun of the last range.
+    if (!ranges_.empty()) {
+      auto& back = ranges_.back();
+      if (back.run == run && back.last + 1 == subRun) {
+        back.last = subRun;
+        ++size_;
+        return true;
+      }
+    }
+
+    // The first range that starts after the subrun.
+    auto const next =
+      std::upper_bound(ranges_.begin(), ranges_.end(), id, startsAfter_);
+    bool const joinsNext =
+      next != ranges_.end() && next->run == run && next->first == subRun + 1;
+    if (next != ranges_.begin()) {
+      auto const prev = std::prev(next);
+      if (prev->run == run) {
+        if (subRun <= prev->last) {
+          return false;
+        }
+        if (prev->last + 1 == subRun) {
+          prev->last = joinsNext ? next->last : subRun;
+          if (joinsNext) {
+            ranges_.erase(next);
+          }
+          ++size_;
+          return true;
+        }
+      }
+    }
+    if (joinsNext) {
+      next->first = subRun;
+    } else {
+      ranges_.insert(next, Range{run, subRun, subRun});
+    }
+    ++size_;
+    return true;
+  }
+
+  bool
+  SubRunRanges::startsAfter_(SubRunID const& id, Range const& r) noexcept
+  {
+    return id.run() < r.run || (id.run() == r.run && id.subRun() < r.first);
+  }
+
+  bool
+  SubRunRanges::contains(SubRunID const& id) const
+  {
+    auto const next =
+      std::upper_bound(ranges_.cbegin(), ranges_.cend(), id, startsAfter_);
+    if (next == ranges_.cbegin()) {
+      return false;
+    }
+    auto const prev = std::prev(next);
+    return prev->run == id.run() && id.subRun() <= prev->last;
+  }
+
+  void
+  SubRunRanges::clear() noexcept
+  {
+    ranges_.clear();
+    size_ = 0;
+  }
+
+  bool
+  SubRunRanges::empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  std::size_t
+  SubRunRanges::size() const noexcept
+  {
+    return size_;
+  }
+
+  std::size_t
+  SubRunRanges::nRanges() const noexcept
+  {
+    return ranges_.size();
+  }
+
+  SubRunRanges::const_iterator
+  SubRunRanges::begin() const
+  {
+    return const_iterator{ranges_.cbegin(), ranges_.cend()};
+  }
+
+  SubRunRanges::const_iterator
+  SubRunRanges::end() const
+  {
+    return const_iterator{ranges_.cend(), ranges_.cend()};
+  }
+
+} // namespace art::detail
@@ -0,0 +1,123 @@
+#ifndef art_Framework_IO_detail_SubRunRanges_h
+#define art_Framework_IO_detail_SubRunRanges_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// SubRunRanges
+//
+// A set of SubRunIDs stored as sorted, disjoint ranges of consecutive
+// subruns within a run.  Subruns are almost always seen in order, so
+// a file holding tens of thousands of subruns typically needs only a
+// handful of ranges, and recording a subrun is a comparison with the
+// last range.
+//
+// Iteration yields the individual SubRunIDs in increasing order.
+// ======================================================================
+
+#include "canvas/Persistency/Provenance/SubRunID.h"
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace art::detail {
+
+  class SubRunRanges {
+    // The subruns [first, last] of run 'run'.
+    struct Range {
+      RunNumber_t run;
+      SubRunNumber_t first;
+      SubRunNumber_t last;
+    };
+    using ranges_t = std::vector<Range>;
+
+  public:
+    class const_iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = SubRunID;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = SubRunID;
+
+      const_iterator() = default;
+
+      SubRunID
+      operator*() const
+      {
+        return SubRunID{it_->run, subRun_};
+      }
+
+      const_iterator&
+      operator++()
+      {
+        if (subRun_ == it_->last) {
+          ++it_;
+          subRun_ = it_ == end_ ? SubRunNumber_t{} : it_->first;
+        } else {
+          ++subRun_;
+        }
+        return *this;
+      }
+
+      const_iterator
+      operator++(int)
+      {
+        auto result = *this;
+        ++*this;
+        return result;
+      }
+
+      friend bool
+      operator==(const_iterator const& a, const_iterator const& b)
+      {
+        return a.it_ == b.it_ && a.subRun_ == b.subRun_;
+      }
+
+      friend bool
+      operator!=(const_iterator const& a, const_iterator const& b)
+      {
+        return !(a == b);
+      }
+
+    private:
+      friend class SubRunRanges;
+      const_iterator(ranges_t::const_iterator const it,
+                     ranges_t::const_iterator const end)
+        : it_{it}
+        , end_{end}
+        , subRun_{it == end ? SubRunNumber_t{} : it->first}
+      {}
+
+      ranges_t::const_iterator it_{};
+      ranges_t::const_iterator end_{};
+      SubRunNumber_t subRun_{};
+    };
+
+    // Returns false if the subrun was already present.
+    bool insert(SubRunID const& id);
+    bool contains(SubRunID const& id) const;
+    void clear() noexcept;
+
+    bool empty() const noexcept;
+    // The number of subruns.
+    std::size_t size() const noexcept;
+    std::size_t nRanges() const noexcept;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+  private:
+    static bool startsAfter_(SubRunID const& id, Range const& r) noexcept;
+
+    ranges_t ranges_{};
+    std::size_t size_{};
+  };
+
+} // namespace art::detail
+
+#endif /* art_Framework_IO_detail_SubRunRanges_h */
+
+// Local Variables:
+// mode: c++
+// End:
@@ -7,10 +7,20 @@
 //
 // Note that BlockingPrescaler prescales based on the number of events
 // seen by this module, *not* the event number as recorded by EventID.
+//
+// If 'hashEventID' is true, each event is instead assigned a position
+// in [0, stepSize) from a hash of its EventID, and it is accepted if
+// that position (shifted by offset) falls within the block.  The
+// accepted fraction remains blockSize/stepSize, but the accepted
+// events are no longer contiguous; in exchange the selection does not
+// depend on the processing order (or the number of schedules), and no
+// lock is taken.
 ////////////////////////////////////////////////////////////////////////
 
 #include "art/Framework/Core/SharedFilter.h"
 #include "art/Framework/Core/fwd.h"
+#include "art/Framework/Modules/detail/prescale_hash.h"
+#include "art/Framework/Principal/Event.h"
 #include "fhiclcpp/types/Atom.h"
 
 #include <mutex>
@@ -32,6 +42,11 @@ public:
       Comment(
         "The value of 'stepSize' cannot be less than that of 'blockSize'.")};
     Atom<size_t> offset{Name("offset"), 0};
+    Atom<bool> hashEventID{
+      Name("hashEventID"),
+      Comment("If true, select events based on a hash of their EventIDs\n"
+              "instead of on the number of events seen so far."),
+      false};
   };
 
   using Parameters = Table<Config>;
@@ -44,6 +59,7 @@ private:
   size_t const m_; // accept m in n (sequentially).
   size_t const n_;
   size_t const offset_; // First accepted event is 1 + offset.
+  bool const hashEventID_;
   std::mutex mutex_{};
 }; // BlockingPrescaler
 
@@ -55,6 +71,7 @@ art::BlockingPrescaler::BlockingPrescaler(Parameters const& config,
   , m_{config().blockSize()}
   , n_{config().stepSize()}
   , offset_{config().offset()}
+  , hashEventID_{config().hashEventID()}
 {
   if (n_ < m_) {
     throw art::Exception{art::errors::Configuration,
@@ -66,8 +83,13 @@ art::BlockingPrescaler::BlockingPrescaler(Parameters const& config,
 }
 
 bool
-art::BlockingPrescaler::filter(Event&, ProcessingFrame const&)
+art::BlockingPrescaler::filter(Event& e, ProcessingFrame const&)
 {
+  if (hashEventID_) {
+    auto const position = detail::prescale_hash(e.id()) % n_;
+    return (position + n_ - offset_ % n_) % n_ < m_;
+  }
+
   // This sequence of operations/comparisons must be serialized.
   // Changing 'count_' to be of type std::atomic<size_t> will not
   // help.  Using a mutex here is cheaper than calling serialize(),
@@ -108,6 +108,8 @@ namespace art {
     void doBeginJob() override;
     void doEndJob() override;
     void skipEvents(int offset) override;
+    input::ItemType skipSubRun(
+      cet::exempt_ptr<RunPrincipal const> rp) override;
     unique_ptr<FileBlock> readFile() override;
     void closeFile() override;
     unique_ptr<RunPrincipal> readRun() override;
@@ -407,4 +409,22 @@ art::EmptyEvent::skipEvents(int offset)
   }
 }
 
+// The subrun and its events are counted toward the processing limits
+// as if they had been read, but no principals are made for them.  A
+// timestamp plugin must see every subrun and event, however.
+art::input::ItemType
+art::EmptyEvent::skipSubRun(cet::exempt_ptr<RunPrincipal const> const rp)
+{
+  if (plugin_) {
+    return InputSource::skipSubRun(rp);
+  }
+  limits_.update(eventID_.subRunID());
+  auto itemType = nextItemType();
+  while (itemType == input::IsEvent) {
+    limits_.update(eventID_);
+    itemType = nextItemType();
+  }
+  return itemType;
+}
+
 DEFINE_ART_INPUT_SOURCE(art::EmptyEvent)
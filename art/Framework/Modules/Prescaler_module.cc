@@ -6,6 +6,8 @@
 
 #include "art/Framework/Core/SharedFilter.h"
 #include "art/Framework/Core/fwd.h"
+#include "art/Framework/Modules/detail/prescale_hash.h"
+#include "art/Framework/Principal/Event.h"
 #include "fhiclcpp/types/Atom.h"
 
 #include <mutex>
@@ -23,6 +25,16 @@ public:
   struct Config {
     Atom<size_t> prescaleFactor{Name("prescaleFactor")};
     Atom<size_t> prescaleOffset{Name("prescaleOffset")};
+    Atom<bool> hashEventID{
+      Name("hashEventID"),
+      Comment(
+        "If 'hashEventID' is true, the decision to accept an event is\n"
+        "made from a hash of its EventID instead of from the number of\n"
+        "events seen so far.  One in 'prescaleFactor' events is still\n"
+        "accepted on average, but the selected events no longer depend\n"
+        "on the order in which they are processed, and therefore not on\n"
+        "the number of schedules or threads.  No lock is taken."),
+      false};
   };
 
   using Parameters = Table<Config>;
@@ -37,6 +49,7 @@ private:
   // An offset is allowed--i.e. sequence of events does not have to
   // start at first event.
   size_t const offset_;
+  bool const hashEventID_;
   std::mutex mutex_{};
 
 }; // Prescaler
@@ -47,13 +60,18 @@ Prescaler::Prescaler(Parameters const& config, ProcessingFrame const&)
   : SharedFilter{config}
   , n_{config().prescaleFactor()}
   , offset_{config().prescaleOffset()}
+  , hashEventID_{config().hashEventID()}
 {
   async<InEvent>();
 }
 
 bool
-Prescaler::filter(Event&, ProcessingFrame const&)
+Prescaler::filter(Event& e, ProcessingFrame const&)
 {
+  if (hashEventID_) {
+    return detail::prescale_hash(e.id()) % n_ == offset_;
+  }
+
   // The combination of incrementing, modulo dividing, and equality
   // comparing must be synchronized.  Changing count_ to the type
   // std::atomic<size_t> would not help since the entire combination
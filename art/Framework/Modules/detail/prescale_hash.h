@@ -0,0 +1,46 @@
+#ifndef art_Framework_Modules_detail_prescale_hash_h
+#define art_Framework_Modules_detail_prescale_hash_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// prescale_hash
+//
+// Returns a well-mixed 64-bit value that depends only on the run,
+// subrun, and event numbers of the given EventID.  The prescaler
+// modules use it to make accept/reject decisions that do not depend
+// on the order in which events arrive, and thus not on the number of
+// schedules or threads.  The value must remain stable across releases
+// and platforms--do not replace it with std::hash.
+// ======================================================================
+
+#include "canvas/Persistency/Provenance/EventID.h"
+
+#include <cstdint>
+
+namespace art::detail {
+
+  // The splitmix64 finalizer.
+  constexpr std::uint64_t
+  splitmix64(std::uint64_t x) noexcept
+  {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+  }
+
+  inline std::uint64_t
+  prescale_hash(EventID const& id) noexcept
+  {
+    auto h = splitmix64(id.run());
+    h = splitmix64(h ^ id.subRun());
+    return splitmix64(h ^ id.event());
+  }
+
+} // namespace art::detail
+
+#endif /* art_Framework_Modules_detail_prescale_hash_h */
+
+// Local Variables:
+// mode: c++
+// End:
@@ -8,6 +8,14 @@
 // Abstract interface used by EventPrincipal to request
 // input sources to retrieve EDProducts from external storage.
 //
+// A principal calls readFromSecondaryFile under its own lock, so the
+// calls for one principal are serialized.  The readers of events on
+// different schedules may, however, be called concurrently, whether
+// the secondary files are opened lazily or eagerly (see the
+// 'eagerSecondaryFiles' scheduler parameter); an implementation whose
+// readers share an input file must serialize access to it (e.g. with
+// a mutex held by the object that owns the file).
+//
 
 #include "art/Framework/Principal/fwd.h"
 #include "canvas/Persistency/Common/EDProduct.h"
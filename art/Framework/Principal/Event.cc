@@ -95,11 +95,14 @@ namespace art {
   void
   Event::commitProducts(
     bool const checkProducts,
-    std::map<TypeLabel, BranchDescription> const* expectedProducts)
+    std::map<TypeLabel, BranchDescription> const* expectedProducts,
+    ParentageCache& parentageCache)
   {
     assert(inserter_);
     inserter_->commitProducts(
-      checkProducts, expectedProducts, ProductRetriever::retrievedPIDs());
+      checkProducts,
+      expectedProducts,
+      ProductRetriever::retrievedParentageID(parentageCache));
   }
 
 } // namespace art
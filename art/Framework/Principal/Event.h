@@ -84,7 +84,8 @@ namespace art {
     void commitProducts();
     void commitProducts(
       bool const checkProducts,
-      std::map<TypeLabel, BranchDescription> const* expectedProducts);
+      std::map<TypeLabel, BranchDescription> const* expectedProducts,
+      ParentageCache& parentageCache);
 
     // Give access to commitProducts(...).
     friend class detail::Analyzer;
@@ -98,28 +98,46 @@ namespace art {
       return product_.load();
     }
 
-    auto assns_type_ids = product_.load()->getTypeIDs();
+    auto const derived = derivedProduct_(wanted_wrapper_type);
+    return derived != nullptr ? derived->load() : product_.load();
+  }
+
+  Group::assns_type_ids_t const&
+  Group::assnsTypeIDs_() const
+  {
+    if (!assnsTypes_) {
+      assnsTypes_ = product_.load()->getTypeIDs();
+    }
+    return *assnsTypes_;
+  }
+
+  // The slot holding the product made from the stored one for the
+  // wanted wrapper type, or nullptr if there is no such product.
+  std::atomic<EDProduct*>*
+  Group::derivedProduct_(TypeID const& wanted_wrapper_type) const
+  {
+    auto const& assns_type_ids = assnsTypeIDs_();
     if (grpType_ == grouptype::assns) {
       assert(assns_type_ids.size() == 2ull);
       if (wanted_wrapper_type ==
           assns_type_ids.at(product_metatype::RightLeft)) {
-        return partnerProduct_.load();
+        return &partnerProduct_;
       }
-      return product_.load();
+      return nullptr;
     }
 
     assert(assns_type_ids.size() == 4ull);
-    if (wanted_wrapper_type == assns_type_ids.at(product_metatype::RightLeft)) {
-      return partnerBaseProduct_.load();
+    if (wanted_wrapper_type ==
+        assns_type_ids.at(product_metatype::RightLeftData)) {
+      return &partnerProduct_;
     }
     if (wanted_wrapper_type == assns_type_ids.at(product_metatype::LeftRight)) {
-      return baseProduct_.load();
+      return &baseProduct_;
     }
-    if (wanted_wrapper_type ==
-        assns_type_ids.at(product_metatype::RightLeftData)) {
-      return partnerProduct_.load();
+    if (wanted_wrapper_type == assns_type_ids.at(product_metatype::RightLeft)) {
+      return &partnerBaseProduct_;
     }
-    return product_.load();
+    return nullptr;
   }
 
   BranchDescription const&
@@ -327,50 +345,23 @@ namespace art {
     auto normal_metatype = (grpType_ == grouptype::assns) ?
                              product_metatype::LeftRight :
                              product_metatype::LeftRightData;
-
-    auto assns_type_ids = product_.load()->getTypeIDs();
-    assert(!assns_type_ids.empty());
-
-    if (wanted_wrapper_type == assns_type_ids.at(normal_metatype)) {
+    if (wanted_wrapper_type == assnsTypeIDs_().at(normal_metatype)) {
       return true;
     }
 
-    auto partner_metatype = (grpType_ == grouptype::assns) ?
-                              product_metatype::RightLeft :
-                              product_metatype::RightLeftData;
-    if (wanted_wrapper_type == assns_type_ids.at(partner_metatype)) {
-      if (partnerProduct_.load() != nullptr) {
-        // They wanted the partner product, and we have already made it, done.
-        return true;
-      }
-      // They want the partner product, ask the wrapper to make it for us,
-      // who ends up asking the assns to do it.
-      partnerProduct_ =
-        product_.load()->makePartner(wanted_wrapper_type.typeInfo()).release();
-      return partnerProduct_.load() != nullptr;
+    auto const derived = derivedProduct_(wanted_wrapper_type);
+    if (derived == nullptr) {
+      return false;
     }
-
-    assert(grpType_ == grouptype::assnsWithData);
-
-    if (wanted_wrapper_type == assns_type_ids.at(product_metatype::LeftRight)) {
-      if (baseProduct_.load() != nullptr) {
-        // They wanted the base product, and we have already made it, done.
-        return true;
-      }
-      // They want the base, ask the wrapper to make it for us,
-      // who ends up asking the assns to do it.
-      baseProduct_ =
+    if (derived->load() == nullptr) {
+      // They want the partner or base product, which we have not yet
+      // made.  Ask the wrapper to make it for us, who ends up asking
+      // the assns to do it.  This copies the association; the copy is
+      // kept until the product is removed.
+      *derived =
         product_.load()->makePartner(wanted_wrapper_type.typeInfo()).release();
-      return baseProduct_.load() != nullptr;
-    }
-    if (partnerBaseProduct_.load() != nullptr) {
-      // They wanted the partner base product, and we have already made it,
-      // done.
-      return true;
     }
-    partnerBaseProduct_ =
-      product_.load()->makePartner(wanted_wrapper_type.typeInfo()).release();
-    return partnerBaseProduct_.load() != nullptr;
+    return derived->load() != nullptr;
   }
 
   bool
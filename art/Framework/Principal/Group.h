@@ -23,6 +23,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <utility>
 #include <vector>
 
 namespace art {
@@ -71,6 +72,14 @@ namespace art {
                                  std::unique_ptr<RangeSet>&&);
 
   private:
+    using assns_type_ids_t =
+      decltype(std::declval<EDProduct const&>().getTypeIDs());
+
+    // Both require that mutex_ be held and that the product be
+    // resolved.
+    assns_type_ids_t const& assnsTypeIDs_() const;
+    std::atomic<EDProduct*>* derivedProduct_(TypeID const& wanted) const;
+
     BranchDescription const& branchDescription_;
 
     // Back pointer to the delayed reader in the principal that owns
@@ -103,6 +112,12 @@ namespace art {
     //
     //  AssnsGroup
     //
+    // The partner and base products below are full copies, made by
+    // EDProduct::makePartner on first request and kept for the rest of
+    // the event; they are not views of the stored product.  Only the
+    // wrapper type IDs used to choose among them are cached
+    // (assnsTypes_).
+    //
     // Note: Modified by setProduct (called by Principal put).
     // Note: Modified by removeCachedProduct.
     // Note: Modified by resolveProductIfAvailable.
@@ -118,6 +133,9 @@ namespace art {
     // Note: Modified by removeCachedProduct.
     // Note: Modified by resolveProductIfAvailable.
     mutable std::atomic<EDProduct*> partnerBaseProduct_{nullptr};
+    // The wrapper types under which an Assns product may be requested.
+    // These do not change when the product is removed and re-read.
+    mutable std::optional<assns_type_ids_t> assnsTypes_{};
   };
 
   std::optional<GroupQueryResult> resolve_unique_product(
@@ -0,0 +1,28 @@
+#include "art/Framework/Principal/ParentageCache.h"
+// vim: set sw=2 expandtab :
+
+#include "canvas/Persistency/Provenance/Parentage.h"
+#include "canvas/Persistency/Provenance/ParentageRegistry.h"
+
+#include <algorithm>
+
+namespace art {
+
+  ParentageID
+  ParentageCache::id(std::set<ProductID> const& parents)
+  {
+    std::lock_guard lock{mutex_};
+    if (id_.isValid() && std::equal(cbegin(parents),
+                                    cend(parents),
+                                    cbegin(parents_),
+                                    cend(parents_))) {
+      return id_;
+    }
+    parents_.assign(cbegin(parents), cend(parents));
+    Parentage const parentage{parents_};
+    id_ = parentage.id();
+    ParentageRegistry::emplace(id_, parentage);
+    return id_;
+  }
+
+} // namespace art
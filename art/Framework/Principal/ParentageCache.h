@@ -0,0 +1,44 @@
+#ifndef art_Framework_Principal_ParentageCache_h
+#define art_Framework_Principal_ParentageCache_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// ParentageCache
+//
+// Remembers the last set of parents for which a module put products
+// into an event, along with the ID of the corresponding Parentage.
+// The set of products retrieved by a module is nearly always the
+// same from one event to the next, so that the Parentage digest need
+// be computed--and the ParentageRegistry consulted--only when that
+// set changes.  Each module owns one such cache; it may be used from
+// several schedules at once.
+// ======================================================================
+
+#include "canvas/Persistency/Provenance/ParentageID.h"
+#include "canvas/Persistency/Provenance/ProductID.h"
+
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace art {
+
+  class ParentageCache {
+  public:
+    // Registers the Parentage if the parents differ from those of
+    // the previous call.
+    ParentageID id(std::set<ProductID> const& parents);
+
+  private:
+    std::mutex mutex_{};
+    std::vector<ProductID> parents_{};
+    ParentageID id_{};
+  };
+
+} // namespace art
+
+#endif /* art_Framework_Principal_ParentageCache_h */
+
+// Local Variables:
+// mode: c++
+// End:
@@ -10,7 +10,7 @@
 #include "art/Framework/Principal/fwd.h"
 #include "art/Persistency/Common/GroupQueryResult.h"
 #include "art/Persistency/Provenance/ModuleContext.h"
-#include "art/Persistency/Provenance/ProcessHistoryRegistry.h"
+#include "art/Persistency/Provenance/ProcessHistoryCache.h"
 #include "canvas/Persistency/Common/WrappedTypeID.h"
 #include "canvas/Persistency/Provenance/BranchDescription.h"
 #include "canvas/Persistency/Provenance/BranchType.h"
@@ -62,6 +62,34 @@ namespace art {
         reader, bd, make_unique<RangeSet>(RangeSet::invalid()), gt);
     }
 
+    void
+    throw_if_collision(Principal::GroupCollection const& groups,
+                       BranchDescription const& pd)
+    {
+      auto it = groups.find(pd.productID());
+      if (it == std::cend(groups)) {
+        return;
+      }
+      // The 'combinable' call does not require that the processing
+      // history be the same, which is not what we are checking for here.
+      auto const& found_pd = it->second->productDescription();
+      if (combinable(found_pd, pd)) {
+        throw Exception(errors::Configuration)
+          << "The process name " << pd.processName()
+          << " was previously used on these products.\n"
+          << "Please modify the configuration file to use a "
+          << "distinct process name.\n";
+      }
+      throw Exception(errors::ProductRegistrationFailure)
+        << "The product ID " << pd.productID() << " of the new product:\n"
+        << pd
+        << " collides with the product ID of the already-existing product:\n"
+        << found_pd
+        << "Please modify the instance name of the new product so as to avoid "
+           "the product ID collision.\n"
+        << "In addition, please notify artists@fnal.gov of this error.\n";
+    }
+
   } // unnamed namespace
 
   void
@@ -105,15 +133,13 @@ namespace art {
     }
   }
 
+  // An unknown history is treated as an empty one.
   void
   Principal::ctor_fetch_process_history(ProcessHistoryID const& phid)
   {
-    if (!phid.isValid()) {
-      return;
+    if (auto history = ProcessHistoryCache::get(phid)) {
+      processHistory_ = history;
     }
-    ProcessHistory processHistory;
-    ProcessHistoryRegistry::get(phid, processHistory);
-    std::swap(processHistory_, processHistory);
   }
 
   Principal::Principal(BranchType branchType,
@@ -123,6 +149,7 @@ namespace art {
                        std::unique_ptr<DelayedReader>&&
                          reader /* = std::make_unique<NoDelayedReader>() */)
     : branchType_{branchType}
+    , processHistory_{ProcessHistoryCache::get(ProcessHistoryID{})}
     , processConfiguration_{pc}
     , presentProducts_{presentProducts.get()}
     , delayedReader_{std::move(reader)}
@@ -137,28 +164,7 @@ namespace art {
   Principal::fillGroup(BranchDescription const& pd)
   {
     std::lock_guard sentry{groupMutex_};
-    auto it = groups_.find(pd.productID());
-    if (it != std::cend(groups_)) {
-      // The 'combinable' call does not require that the processing
-      // history be the same, which is not what we are checking for here.
-      auto const& found_pd = it->second->productDescription();
-      if (combinable(found_pd, pd)) {
-        throw Exception(errors::Configuration)
-          << "The process name " << pd.processName()
-          << " was previously used on these products.\n"
-          << "Please modify the configuration file to use a "
-          << "distinct process name.\n";
-      }
-      throw Exception(errors::ProductRegistrationFailure)
-        << "The product ID " << pd.productID() << " of the new product:\n"
-        << pd
-        << " collides with the product ID of the already-existing product:\n"
-        << found_pd
-        << "Please modify the instance name of the new product so as to avoid "
-           "the product ID collision.\n"
-        << "In addition, please notify artists@fnal.gov of this error.\n";
-    }
-
+    throw_if_collision(groups_, pd);
     groups_[pd.productID()] = create_group(delayedReader_.get(), pd);
   }
 
@@ -209,10 +215,13 @@ namespace art {
     // The process history is expanded if there is a product that is
     // produced in this process.
     addToProcessHistory();
+    // Products of this process must not collide with those read from
+    // the input; their groups are created when first needed (see
+    // getGroupLocal).
+    std::lock_guard sentry{groupMutex_};
     for (auto const& pd : produced.descriptions | ::ranges::views::values) {
       assert(pd.branchType() == branchType_);
-      // Create a group for the produced product.
-      fillGroup(pd);
+      throw_if_collision(groups_, pd);
     }
   }
 
@@ -246,11 +255,9 @@ namespace art {
   ProcessHistory const&
   Principal::processHistory() const
   {
-    // MT note: We make no attempt to protect callers who use this
-    //          call to get access to the iteration interface of the
-    //          process history.  See the threading notes there and
-    //          here for the reasons why.
-    return processHistory_;
+    // The history is immutable; extending it replaces it with
+    // another (cached) one.
+    return *processHistory_.load();
   }
 
   ProcessConfiguration const&
@@ -263,13 +270,17 @@ namespace art {
   Principal::size() const
   {
     std::lock_guard sentry{groupMutex_};
+    createAllProducedGroups_();
     return groups_.size();
   }
 
+  // Iteration visits every group, including those of products of this
+  // process that have not yet been needed.
   Principal::const_iterator
   Principal::begin() const
   {
     std::lock_guard sentry{groupMutex_};
+    createAllProducedGroups_();
     return groups_.begin();
   }
 
@@ -277,6 +288,7 @@ namespace art {
   Principal::cbegin() const
   {
     std::lock_guard sentry{groupMutex_};
+    createAllProducedGroups_();
     return groups_.cbegin();
   }
 
@@ -397,44 +409,22 @@ namespace art {
   //
   // Note: threading: If the only uses were from the constructors
   // we would have no problems, but the use from the root output
-  // module is bad because it could be running concurrently with
-  // other output modules and analyzers for this same principal.
-  // So we have to use a compare_exchange_strong on
-  // processHistoryModified_ so that only one task tries to do
-  // this. We also need to stall the other output and analyzer
-  // modules that call processHistory() while we are doing the
-  // update so that they get the updated result.  For output and
-  // analyzer modules that have already fetched the process
-  // history pointer, we have to stall any attempt to access its
-  // internal process configuration list while we are updating it.
-  //
-  // FIXME: threading: We hand out processHistory_ through the
-  // processHistory() interface, which is in turn handed out by
-  // the ProductRetriever::processHistory() interface to any module
-  // task that wants it.  This is a problem for output modules
-  // and analyzers if an output module decides to update the
-  // process history from startEndFile. We must stall users of
-  // the process history if we updating it, both by stalling a
-  // fetch of processHistory_ once we start to update, and for
-  // those modules that have already fetched the processHistory_
-  // we must stall any attempt by them to access its internal
-  // process configuration list while we are changing it.
+  // module could be running concurrently with other output modules
+  // and analyzers for this same principal.  So we have to use a
+  // compare_exchange_strong on processHistoryModified_ so that only
+  // one task tries to do this.  The histories themselves are
+  // immutable and shared through the ProcessHistoryCache: extending
+  // the history swaps in a pointer to the extended one, so that a
+  // task that has already fetched the old history may keep reading
+  // it.
   void
   Principal::addToProcessHistory()
   {
     bool expected = false;
     if (processHistoryModified_.compare_exchange_strong(expected, true)) {
-      // MT note: We have now locked out any other task trying to
-      //          modify the process history. Now we have to block
-      //          tasks that already have a pointer to the process
-      //          history from accessing its internals while we update
-      //          it. We do not protect the iteration interface, the
-      //          begin(), end(), and size() are all separate calls
-      //          and we cannot lock in each one because there is no
-      //          way to automatically unlock.
-      std::lock_guard sentry{processHistory_.get_mutex()};
+      auto const& history = *processHistory_.load();
       string const& processName = processConfiguration_.processName();
-      for (auto const& val : processHistory_) {
+      for (auto const& val : history) {
         if (processName == val.processName()) {
           throw Exception(errors::Configuration)
             << "The process name " << processName
@@ -443,17 +433,11 @@ namespace art {
             << "distinct process name.\n";
         }
       }
-      processHistory_.push_back(processConfiguration_);
-      // Optimization note: As of 0_9_0_pre3 For very simple Sources
-      // (e.g. EmptyEvent) this routine takes up nearly 50% of the
-      // time per event, and 96% of the time for this routine is spent
-      // in computing the ProcessHistory id which happens because we
-      // are reconstructing the ProcessHistory for each event.  It
-      // would probably be better to move the ProcessHistory
-      // construction out to somewhere which persists for longer than
-      // one Event.
-      auto const phid = processHistory_.id();
-      ProcessHistoryRegistry::emplace(phid, processHistory_);
+      // The extended history, its ID and its registration are
+      // computed once per distinct input history, rather than for
+      // each principal.
+      processHistory_ =
+        &ProcessHistoryCache::extend(history, processConfiguration_);
     }
   }
 
@@ -467,16 +451,11 @@ namespace art {
     // to stop after we find a process with matches so check for that
     // at each step.
     std::size_t found{};
-    // MT note: We must protect the process history iterators here
-    //          against possible invalidation by output modules
-    //          inserting a process history entry while we are
-    //          iterating.
-    std::lock_guard sentry{processHistory_.get_mutex()};
     // We must skip over duplicate entries of the same process
     // configuration in the process history.  This unfortunately
     // happened with the SamplingInput source.
-    for (auto const& h :
-         ::ranges::views::reverse(processHistory_) | ::ranges::views::unique) {
+    for (auto const& h : ::ranges::views::reverse(processHistory()) |
+                           ::ranges::views::unique) {
       if (auto it = pl.find(h.processName()); it != pl.end()) {
         found += findGroupsForProcess(it->second, mc, sel, groups);
       }
@@ -540,10 +519,39 @@ namespace art {
     return resolve_products(groups, wrapped.wrapped_product_type);
   }
 
-  auto
-  Principal::tryNextSecondaryFile() const
+  bool
+  Principal::openNextSecondaryFile_() const
   {
-    return delayedReader_->readFromSecondaryFile(nextSecondaryFileIdx_);
+    if (secondaryFilesExhausted_) {
+      return false;
+    }
+    auto sp = delayedReader_->readFromSecondaryFile(nextSecondaryFileIdx_);
+    if (!sp) {
+      secondaryFilesExhausted_ = true;
+      return false;
+    }
+    secondaryPrincipals_.push_back(std::move(sp));
+    return true;
+  }
+
+  cet::exempt_ptr<Principal>
+  Principal::secondaryPrincipal_(std::size_t const i, bool const open) const
+  {
+    std::lock_guard sentry{secondaryMutex_};
+    while (i >= secondaryPrincipals_.size()) {
+      if (!open || !openNextSecondaryFile_()) {
+        return nullptr;
+      }
+    }
+    return secondaryPrincipals_[i].get();
+  }
+
+  void
+  Principal::openAllSecondaryFiles() const
+  {
+    std::lock_guard sentry{secondaryMutex_};
+    while (openNextSecondaryFile_()) {
+    }
   }
 
   std::vector<cet::exempt_ptr<Group>>
@@ -571,23 +579,14 @@ namespace art {
       if (!groups.empty()) {
         return groups;
       }
-      for (auto const& sp : secondaryPrincipals_) {
+      // Look through secondary files, opening more if necessary
+      for (std::size_t i{}; auto const sp = secondaryPrincipal_(i); ++i) {
         groups = sp->matchingSequenceFromInputFile(mc, selector);
         if (!groups.empty()) {
           return groups;
         }
       }
     }
-    // Open more secondary files if necessary
-    if (groups.empty()) {
-      while (auto sp = tryNextSecondaryFile()) {
-        auto& new_sp = secondaryPrincipals_.emplace_back(std::move(sp));
-        groups = new_sp->matchingSequenceFromInputFile(mc, selector);
-        if (!groups.empty()) {
-          return groups;
-        }
-      }
-    }
     return groups;
   }
 
@@ -648,18 +647,12 @@ namespace art {
     if (ret) {
       return results;
     }
-    for (auto const& sp : secondaryPrincipals_) {
+    // Look through secondary files, opening more if necessary
+    for (std::size_t i{}; auto const sp = secondaryPrincipal_(i); ++i) {
       if (sp->findGroupsFromInputFile(mc, wrapped, selector, results)) {
         return results;
       }
     }
-    // Open more secondary files if necessary
-    while (auto sp = tryNextSecondaryFile()) {
-      auto& new_sp = secondaryPrincipals_.emplace_back(std::move(sp));
-      if (new_sp->findGroupsFromInputFile(mc, wrapped, selector, results)) {
-        return results;
-      }
-    }
     return results;
   }
 
@@ -795,7 +788,9 @@ namespace art {
         return result;
       }
     }
-    for (auto const& sp : secondaryPrincipals_) {
+    for (std::size_t i{};
+         auto const sp = secondaryPrincipal_(i, false /*open*/);
+         ++i) {
       if (auto result = sp->getProductDescription(pid)) {
         return result;
       }
@@ -852,8 +847,38 @@ namespace art {
   Principal::getGroupLocal(ProductID const pid) const
   {
     std::lock_guard sentry{groupMutex_};
-    auto it = groups_.find(pid);
-    return it != groups_.cend() ? it->second.get() : nullptr;
+    if (auto it = groups_.find(pid); it != groups_.cend()) {
+      return it->second.get();
+    }
+    // Most products of this process are never produced for a given
+    // event (e.g. if it is rejected by a filter), so their groups are
+    // created only when first needed.
+    auto const produced = producedProducts_.load();
+    if (produced == nullptr) {
+      return nullptr;
+    }
+    auto const pd = produced->description(pid);
+    if (pd == nullptr) {
+      return nullptr;
+    }
+    auto& group = groups_[pid];
+    group = create_group(delayedReader_.get(), *pd);
+    return group.get();
+  }
+
+  void
+  Principal::createAllProducedGroups_() const
+  {
+    auto const produced = producedProducts_.load();
+    if (allProducedGroupsCreated_ || produced == nullptr) {
+      return;
+    }
+    for (auto const& [pid, pd] : produced->descriptions) {
+      if (groups_.find(pid) == groups_.cend()) {
+        groups_.emplace(pid, create_group(delayedReader_.get(), pd));
+      }
+    }
+    allProducedGroupsCreated_ = true;
   }
 
   cet::exempt_ptr<Group>
@@ -863,19 +888,12 @@ namespace art {
     if (producedInProcess(pid) || presentFromSource(pid)) {
       return getGroupLocal(pid);
     }
-    // Look through secondary files
-    for (auto const& sp : secondaryPrincipals_) {
+    // Look through secondary files, opening more if necessary
+    for (std::size_t i{}; auto const sp = secondaryPrincipal_(i); ++i) {
       if (sp->presentFromSource(pid)) {
         return sp->getGroupLocal(pid);
       }
     }
-    // Try new secondary files
-    while (auto sp = tryNextSecondaryFile()) {
-      auto& new_sp = secondaryPrincipals_.emplace_back(std::move(sp));
-      if (new_sp->presentFromSource(pid)) {
-        return new_sp->getGroupLocal(pid);
-      }
-    }
     return nullptr;
   }
 
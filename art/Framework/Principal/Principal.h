@@ -129,7 +129,8 @@ namespace art {
 
     // The product tables data member for produced products is set by
     // the EventProcessor after the Principal is provided by the input
-    // source.
+    // source.  The groups themselves are created only when first
+    // needed--e.g. when the product is put or looked up.
     void createGroupsForProducedProducts(ProductTables const& producedProducts);
     void enableLookupOfProducedProducts();
 
@@ -147,7 +148,7 @@ namespace art {
     ProcessHistoryID const&
     processHistoryID() const
     {
-      return processHistory_.id();
+      return processHistory_.load()->id();
     }
 
     cet::exempt_ptr<ProductProvenance const> branchToProductProvenance(
@@ -168,6 +169,10 @@ namespace art {
 
     RangeSet seenRanges() const;
 
+    // Opens every remaining secondary file, rather than waiting for a
+    // product lookup to require it.
+    void openAllSecondaryFiles() const;
+
     void put(BranchDescription const&,
              std::unique_ptr<ProductProvenance const>&&,
              std::unique_ptr<EDProduct>&&,
@@ -183,6 +188,8 @@ namespace art {
     void ctor_fetch_process_history(ProcessHistoryID const&);
 
     cet::exempt_ptr<Group> getGroupLocal(ProductID const) const;
+    // Requires that groupMutex_ be held.
+    void createAllProducedGroups_() const;
 
     std::vector<cet::exempt_ptr<Group>> matchingSequenceFromInputFile(
       ModuleContext const&,
@@ -203,7 +210,12 @@ namespace art {
       std::vector<cet::exempt_ptr<Group>>& groups) const;
     bool producedInProcess(ProductID) const;
     bool presentFromSource(ProductID) const;
-    auto tryNextSecondaryFile() const;
+    // The i-th secondary principal, opening further secondary files
+    // if necessary and allowed; nullptr if there is no such principal.
+    cet::exempt_ptr<Principal> secondaryPrincipal_(std::size_t i,
+                                                   bool open = true) const;
+    // Requires that secondaryMutex_ be held.
+    bool openNextSecondaryFile_() const;
 
     // Implementation of the ProductRetriever API.
     std::vector<cet::exempt_ptr<Group>> findGroupsForProduct(
@@ -228,7 +240,8 @@ namespace art {
 
   private:
     BranchType branchType_{};
-    ProcessHistory processHistory_{};
+    // Owned by the ProcessHistoryCache.
+    std::atomic<ProcessHistory const*> processHistory_;
     std::atomic<bool> processHistoryModified_{false};
     ProcessConfiguration const& processConfiguration_;
 
@@ -240,10 +253,12 @@ namespace art {
     // Protects access to groups_.
     mutable std::recursive_mutex groupMutex_{};
 
-    // All of the currently known data products.
+    // All of the currently known data products.  The groups for
+    // products of the current process are added on demand.
     // tbb::concurrent_unordered_map<ProductID, std::unique_ptr<Group>>
     // groups_{};
-    GroupCollection groups_{};
+    mutable GroupCollection groups_{};
+    mutable bool allProducedGroupsCreated_{false};
 
     // Pointer to the reader that will be used to obtain
     // EDProducts from the persistent store.
@@ -253,16 +268,22 @@ namespace art {
     // and SubRun principals do not exceed the lifetime of the input
     // file.
     //
-    // Note: To make secondary file-reading thread-safe, we will need to
-    //       ensure that any adjustments to the secondaryPrincipals_
-    //       vector is done atomically with respect to any reading of
-    //       the vector.
+    // Secondary files are opened one at a time, in order, under
+    // secondaryMutex_, so that each is opened once no matter how many
+    // module tasks are looking for products in it.  The principals
+    // are never removed, so that a pointer obtained under the lock
+    // remains valid after it is released.
+    mutable std::recursive_mutex secondaryMutex_{};
     mutable std::vector<std::unique_ptr<Principal>> secondaryPrincipals_{};
 
     // Index into the secondary file names vector of the next
     // file that a secondary principal should be created from.
     mutable int nextSecondaryFileIdx_{};
 
+    // Set once the delayed reader has no more secondary files to
+    // offer.
+    mutable bool secondaryFilesExhausted_{false};
+
     RangeSet rangeSet_{RangeSet::invalid()};
   };
 
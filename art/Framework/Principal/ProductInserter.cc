@@ -7,7 +7,6 @@
 #include "art/Framework/Principal/Selector.h"
 #include "art/Persistency/Provenance/ModuleContext.h"
 #include "art/Persistency/Provenance/ProcessHistoryRegistry.h"
-#include "canvas/Persistency/Provenance/Parentage.h"
 #include "canvas/Persistency/Provenance/ProductID.h"
 #include "canvas/Persistency/Provenance/ProductProvenance.h"
 #include "canvas/Persistency/Provenance/canonicalProductName.h"
@@ -44,7 +43,7 @@ namespace art {
   ProductInserter::commitProducts(
     bool const checkProducts,
     map<TypeLabel, BranchDescription> const* expectedProducts,
-    std::vector<ProductID> retrievedPIDs)
+    ParentageID const& parentageID)
   {
     assert(branchType_ == InEvent);
     std::lock_guard lock{*mutex_};
@@ -74,7 +73,7 @@ namespace art {
 
     for (auto&& [product, pd, rs] : putProducts_ | ::ranges::views::values) {
       auto pp = make_unique<ProductProvenance const>(
-        pd.productID(), productstatus::present(), retrievedPIDs);
+        pd.productID(), productstatus::present(), parentageID);
       principal_->put(pd,
                       std::move(pp),
                       std::move(product),
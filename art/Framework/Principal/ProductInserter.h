@@ -13,6 +13,7 @@
 #include "canvas/Persistency/Common/traits.h"
 #include "canvas/Persistency/Provenance/BranchDescription.h"
 #include "canvas/Persistency/Provenance/BranchType.h"
+#include "canvas/Persistency/Provenance/ParentageID.h"
 #include "canvas/Persistency/Provenance/ProductID.h"
 #include "canvas/Persistency/Provenance/TypeLabel.h"
 #include "canvas/Persistency/Provenance/fwd.h"
@@ -61,7 +62,7 @@ namespace art {
     void commitProducts(
       bool checkProducts,
       std::map<TypeLabel, BranchDescription> const* expectedProducts,
-      std::vector<ProductID> retrievedPIDs);
+      ParentageID const& parentageID);
 
   private:
     struct PMValue {
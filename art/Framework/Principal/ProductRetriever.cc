@@ -3,6 +3,7 @@
 
 #include "art/Framework/Principal/ConsumesInfo.h"
 #include "art/Framework/Principal/Group.h"
+#include "art/Framework/Principal/ParentageCache.h"
 #include "art/Framework/Principal/Principal.h"
 #include "art/Framework/Principal/ProcessTag.h"
 #include "art/Framework/Principal/ProductInfo.h"
@@ -74,6 +75,13 @@ namespace art {
                                   end(retrievedProducts_));
   }
 
+  ParentageID
+  ProductRetriever::retrievedParentageID(ParentageCache& cache) const
+  {
+    std::lock_guard lock{mutex_};
+    return cache.id(retrievedProducts_);
+  }
+
   std::optional<Provenance const>
   ProductRetriever::getProductProvenance(ProductID const pid) const
   {
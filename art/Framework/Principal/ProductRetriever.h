@@ -15,6 +15,7 @@
 #include "canvas/Persistency/Common/traits.h"
 #include "canvas/Persistency/Provenance/BranchDescription.h"
 #include "canvas/Persistency/Provenance/BranchType.h"
+#include "canvas/Persistency/Provenance/ParentageID.h"
 #include "canvas/Persistency/Provenance/ProductID.h"
 #include "canvas/Persistency/Provenance/ProductToken.h"
 #include "canvas/Persistency/Provenance/fwd.h"
@@ -151,6 +152,7 @@ namespace art {
     bool getView(ViewToken<ELEMENT> const&, View<ELEMENT>& result) const;
 
     std::vector<ProductID> retrievedPIDs() const;
+    ParentageID retrievedParentageID(ParentageCache& cache) const;
 
     // Miscellaneous functionality
     std::optional<Provenance const> getProductProvenance(ProductID) const;
@@ -139,9 +139,20 @@ namespace art {
   SerialTaskQueueChain*
   Worker::serialTaskQueueChain() const
   {
+    if (replicaQueue_) {
+      return replicaQueue_.get();
+    }
     return doSerialTaskQueueChain();
   }
 
+  void
+  Worker::shareReplica(std::shared_ptr<SerialTaskQueueChain> queue,
+                       bool const first)
+  {
+    replicaQueue_ = move(queue);
+    firstReplicaUser_ = first;
+  }
+
   // Used by EventProcessor
   // Used by Schedule
   // Used by EndPathExecutor
@@ -588,13 +599,34 @@ namespace art {
     TDEBUG_END_TASK_SI(4, sid);
   }
 
+  void
+  Worker::runWorker(Transition const trans,
+                    Principal& p,
+                    ModuleContext const& mc)
+  {
+    auto const sid = mc.scheduleID();
+    TDEBUG_BEGIN_TASK_SI(4, sid);
+    // The exception (if any) has already been cached and decorated
+    // with the module context by doWork.
+    exception_ptr ex_ptr{};
+    try {
+      doWork(trans, p, mc);
+    }
+    catch (...) {
+      ex_ptr = current_exception();
+    }
+    waitingTasks_.doneWaiting(ex_ptr);
+    TDEBUG_END_TASK_SI(4, sid) << (ex_ptr ? "because of EXCEPTION" : "");
+  }
+
   bool
   Worker::isUnique() const
   {
     if (scheduleID_ == ScheduleID::first()) {
       return true;
     }
-    return md_.moduleThreadingType() == ModuleThreadingType::replicated;
+    return md_.moduleThreadingType() == ModuleThreadingType::replicated &&
+           firstReplicaUser_;
   }
 
   void
@@ -619,7 +651,8 @@ namespace art {
     bool expected = false;
     if (workStarted_.compare_exchange_strong(expected, true)) {
       if (auto chain = serialTaskQueueChain()) {
-        // Must be a serialized shared module (including legacy).
+        // Must be a serialized shared module (including legacy), or a
+        // replicated module whose copy is shared by several schedules.
         TDEBUG_FUNC_SI(4, sid) << "pushing onto chain " << hex << chain << dec;
         chain->push([&p, &mc, this] { runWorker(p, mc); });
         TDEBUG_END_FUNC_SI(4, sid);
@@ -636,4 +669,34 @@ namespace art {
     TDEBUG_END_FUNC_SI(4, sid) << "work already in progress on another path";
   }
 
+  void
+  Worker::doWork(WaitingTaskPtr workerInPathDoneTask,
+                 Transition const trans,
+                 Principal& p,
+                 ModuleContext const& mc)
+  {
+    auto const sid = mc.scheduleID();
+    TDEBUG_BEGIN_FUNC_SI(4, sid);
+    // Note: As with events, a worker may appear on more than one
+    // path, and the paths run concurrently.  The worker itself runs
+    // only once per transition, but all paths waiting on it must be
+    // notified when it is done.
+    waitingTasks_.add(workerInPathDoneTask);
+    bool expected = false;
+    if (workStarted_.compare_exchange_strong(expected, true)) {
+      if (auto chain = serialTaskQueueChain()) {
+        // Must be a serialized shared module (including legacy).
+        TDEBUG_FUNC_SI(4, sid) << "pushing onto chain " << hex << chain << dec;
+        chain->push([trans, &p, &mc, this] { runWorker(trans, p, mc); });
+        TDEBUG_END_FUNC_SI(4, sid);
+        return;
+      }
+      // Must be a replicated or shared module with no serialization.
+      runWorker(trans, p, mc);
+      TDEBUG_END_FUNC_SI(4, sid);
+      return;
+    }
+    TDEBUG_END_FUNC_SI(4, sid) << "work already in progress on another path";
+  }
+
 } // namespace art
@@ -29,6 +29,7 @@
 
 #include <atomic>
 #include <exception>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -59,6 +60,12 @@ namespace art {
     void respondToCloseOutputFiles(FileBlock const& fb);
     void doWork(Transition, Principal&, ModuleContext const&);
 
+    // Used for run and subrun transitions.
+    void doWork(hep::concurrency::WaitingTaskPtr workerInPathDoneTask,
+                Transition,
+                Principal&,
+                ModuleContext const&);
+
     void doWork_event(hep::concurrency::WaitingTaskPtr workerInPathDoneTask,
                       EventPrincipal&,
                       ModuleContext const&);
@@ -77,6 +84,13 @@ namespace art {
     ModuleDescription const& description() const;
     hep::concurrency::SerialTaskQueueChain* serialTaskQueueChain() const;
 
+    // Used only by PathManager, when schedules share a copy of a
+    // replicated module.  The copy runs on the given queue, and only
+    // the worker of the first schedule using it is unique.
+    void shareReplica(
+      std::shared_ptr<hep::concurrency::SerialTaskQueueChain> queue,
+      bool first);
+
     // Used by EventProcessor
     // Used by Schedule
     // Used by EndPathExecutor
@@ -90,6 +104,7 @@ namespace art {
     std::size_t timesExcept() const;
 
     void runWorker(EventPrincipal&, ModuleContext const&);
+    void runWorker(Transition, Principal&, ModuleContext const&);
     bool isUnique() const;
 
   protected:
@@ -136,6 +151,10 @@ namespace art {
     std::atomic<bool> workStarted_{false};
     std::atomic<bool> returnCode_{false};
 
+    // Set only for shared copies of replicated modules.
+    std::shared_ptr<hep::concurrency::SerialTaskQueueChain> replicaQueue_{};
+    bool firstReplicaUser_{true};
+
     // Holds the waiting workerInPathDone tasks.  Note: For shared
     // modules the workers are shared.  For replicated modules each
     // schedule has its own private worker copies (the whole reason
@@ -18,6 +18,7 @@ namespace art {
   template <typename T>
   class Handle;
   class NoDelayedReader;
+  class ParentageCache;
   class Principal;
   class ProcessTag;
   class Provenance;
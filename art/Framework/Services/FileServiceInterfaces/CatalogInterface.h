@@ -9,6 +9,14 @@
 // get next file in a series, and deal with declarations that output
 // files have been written.  We have in mind that SAMProtocol will
 // inherit from this interface class.
+//
+// Input files may be requested on a background thread (see
+// FilePrefetcher.h) while the source reports on the files it has
+// taken, so the calls concerning file delivery are serialized with a
+// lock of their own.  The calls made by output modules do not wait for
+// a delivery in progress; as before, they must not be made from more
+// than one thread at a time.  An implementation must protect any state
+// shared between the two kinds of call.
 // ======================================================================
 
 #include "art/Framework/Services/FileServiceInterfaces/FileDisposition.h"
@@ -17,6 +25,7 @@
 #include "fhiclcpp/fwd.h"
 #include "hep_concurrency/assert_only_one_thread.h"
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -59,11 +68,14 @@ namespace art {
                                  HLTGlobalStatus const& acceptance_info) = 0;
     virtual bool doIsSearchable() = 0;
     virtual void doRewind() = 0;
+
+    std::mutex deliveryMutex_{};
   };
 
   inline void
   CatalogInterface::configure(std::vector<std::string> const& items)
   {
+    std::lock_guard lock{deliveryMutex_};
     HEP_CONCURRENCY_ASSERT_ONLY_ONE_THREAD();
     doConfigure(items);
   }
@@ -71,6 +83,7 @@ namespace art {
   inline int
   CatalogInterface::getNextFileURI(std::string& uri, double& waitTime)
   {
+    std::lock_guard lock{deliveryMutex_};
     HEP_CONCURRENCY_ASSERT_ONLY_ONE_THREAD();
     return doGetNextFileURI(uri, waitTime);
   }
@@ -78,6 +91,7 @@ namespace art {
   inline void
   CatalogInterface::updateStatus(std::string const& uri, FileDisposition status)
   {
+    std::lock_guard lock{deliveryMutex_};
     HEP_CONCURRENCY_ASSERT_ONLY_ONE_THREAD();
     doUpdateStatus(uri, status);
   }
@@ -117,6 +131,7 @@ namespace art {
   inline bool
   CatalogInterface::isSearchable()
   {
+    std::lock_guard lock{deliveryMutex_};
     HEP_CONCURRENCY_ASSERT_ONLY_ONE_THREAD();
     return doIsSearchable();
   }
@@ -124,6 +139,7 @@ namespace art {
   inline void
   CatalogInterface::rewind()
   {
+    std::lock_guard lock{deliveryMutex_};
     HEP_CONCURRENCY_ASSERT_ONLY_ONE_THREAD();
     doRewind();
   }
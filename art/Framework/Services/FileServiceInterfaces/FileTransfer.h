@@ -9,10 +9,15 @@
 // of a file that has been copied into local scratch, when given a URI
 // specifying a desired file.  We have in mind that
 // GeneralFileTransfer will inherit from this interface class.
+//
+// Files may be transferred on a background thread (see
+// FilePrefetcher.h) while the source retries a failed transfer, so
+// calls to translateToLocalFilename are serialized with a lock.
 // ====================================================================
 
 #include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
 
+#include <mutex>
 #include <string>
 
 namespace art {
@@ -26,12 +31,15 @@ namespace art {
   private:
     virtual int doTranslateToLocalFilename(std::string const& uri,
                                            std::string& fileFQname) = 0;
+
+    std::mutex transferMutex_{};
   };
 
   inline int
   FileTransfer::translateToLocalFilename(std::string const& uri,
                                          std::string& fileFQname)
   {
+    std::lock_guard lock{transferMutex_};
     return doTranslateToLocalFilename(uri, fileFQname);
   }
 
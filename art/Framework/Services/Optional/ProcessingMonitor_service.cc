@@ -0,0 +1,618 @@
+// vim: set sw=2 expandtab :
+// ======================================================================
+// ProcessingMonitor
+//
+// Periodically writes rolling-window processing metrics to a local
+// file, for collection by a node agent while the job is running:
+//
+//   - the event rate,
+//   - the 50th and 99th percentiles of each module's event-processing
+//     time, and of each output module's event-writing time,
+//   - for each schedule, the fraction of the time it spent idle, waiting
+//     to read an event, and waiting to write one,
+//   - the resident set size of the process (Linux only).
+//
+// The "input wait" of a schedule is the time from its finishing one
+// event to its starting to read the next, which is dominated by
+// waiting for the input-source lock but also includes run and subrun
+// transitions.  The "output wait" is the time from the end of an
+// event's processing to the start of its writing.  A schedule is idle
+// whenever it is not between reading an event and finishing its
+// processing or writing.
+//
+// The metrics are written in the Prometheus text format (the file is
+// replaced atomically), or as JSON lines (a line is appended per
+// interval).  The signal handlers that run for each event and module
+// only update atomic counters; all other work is done on a separate
+// thread.
+// ======================================================================
+
+#include "art/Framework/Principal/Event.h"
+#include "art/Framework/Services/Optional/detail/LatencyHistogram.h"
+#include "art/Framework/Services/Registry/ActivityRegistry.h"
+#include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
+#include "art/Framework/Services/Registry/ServiceDefinitionMacros.h"
+#include "art/Framework/Services/Registry/ServiceTable.h"
+#include "art/Persistency/Provenance/ModuleContext.h"
+#include "art/Persistency/Provenance/ModuleDescription.h"
+#include "art/Persistency/Provenance/ScheduleContext.h"
+#include "art/Utilities/Globals.h"
+#include "art/Utilities/ScheduleID.h"
+#ifdef __linux__
+#include "art/Utilities/LinuxProcData.h"
+#include "art/Utilities/LinuxProcMgr.h"
+#endif
+#include "canvas/Utilities/Exception.h"
+#include "fhiclcpp/types/Atom.h"
+#include "fhiclcpp/types/Name.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+extern "C" {
+#include <unistd.h>
+}
+
+using namespace std::string_literals;
+using std::chrono::steady_clock;
+
+namespace art {
+
+  namespace {
+
+    std::int64_t
+    now_ns()
+    {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               steady_clock::now().time_since_epoch())
+        .count();
+    }
+
+    constexpr auto no_index = static_cast<std::size_t>(-1);
+
+    // Written only from the signals of one schedule, which see at
+    // most one event at a time.
+    struct alignas(64) ScheduleData {
+      std::atomic<std::int64_t> eventStart{};
+      std::atomic<std::int64_t> processEnd{-1};
+      std::atomic<std::int64_t> writeStart{};
+      std::atomic<std::int64_t> lastEnd{};
+      std::atomic<std::uint64_t> busy{};
+      std::atomic<std::uint64_t> inputWait{};
+      std::atomic<std::uint64_t> outputWait{};
+    };
+
+    void
+    add(std::atomic<std::uint64_t>& counter, std::int64_t const ns)
+    {
+      if (ns > 0) {
+        counter.fetch_add(ns, std::memory_order_relaxed);
+      }
+    }
+
+    struct ScheduleTimes {
+      std::uint64_t busy;
+      std::uint64_t inputWait;
+      std::uint64_t outputWait;
+    };
+
+    struct Snapshot {
+      std::int64_t time;
+      std::uint64_t events;
+      std::vector<ScheduleTimes> schedules;
+      std::vector<detail::LatencyHistogram::counts_t> modules;
+      std::vector<detail::LatencyHistogram::counts_t> writes;
+    };
+
+    // Prometheus label values and JSON strings need the same escapes
+    // for module labels.
+    std::string
+    quoted(std::string const& s)
+    {
+      std::string result{'"'};
+      for (auto const c : s) {
+        if (c == '"' || c == '\\') {
+          result += '\\';
+        }
+        result += c;
+      }
+      return result + '"';
+    }
+
+  } // unnamed namespace
+
+  class ProcessingMonitor {
+  public:
+    static constexpr bool service_handle_allowed{false};
+
+    struct Config {
+      fhicl::Atom<std::string> filename{fhicl::Name{"filename"}};
+      fhicl::Atom<std::string> format{
+        fhicl::Name{"format"},
+        fhicl::Comment{"\"prometheus\" or \"json\"."},
+        "prometheus"};
+      fhicl::Atom<double> interval{
+        fhicl::Name{"interval"},
+        fhicl::Comment{"Seconds between updates of the file."},
+        10.};
+      fhicl::Atom<double> window{
+        fhicl::Name{"window"},
+        fhicl::Comment{"Seconds over which the rates, fractions and\n"
+                       "percentiles are computed."},
+        60.};
+    };
+    using Parameters = ServiceTable<Config>;
+    explicit ProcessingMonitor(Parameters const&, ActivityRegistry&);
+    ~ProcessingMonitor();
+
+  private:
+    void postModuleConstruction(ModuleDescription const&);
+    void postBeginJob();
+    void postEndJob();
+    void preSourceEvent(ScheduleContext);
+    void postSourceEvent(Event const&, ScheduleContext);
+    void postProcessEvent(Event const&, ScheduleContext);
+    void preModule(ModuleContext const&);
+    void postModule(ModuleContext const&);
+    void preWriteEvent(ModuleContext const&);
+    void postWriteEvent(ModuleContext const&);
+
+    std::size_t moduleIndex_(ModuleContext const& mc) const;
+    void start_(std::unique_ptr<std::atomic<std::int64_t>[]> const& starts,
+                ModuleContext const& mc);
+    void record_(std::unique_ptr<std::atomic<std::int64_t>[]> const& starts,
+                 std::unique_ptr<detail::LatencyHistogram[]> const& latencies,
+                 ModuleContext const& mc);
+    Snapshot snapshot_() const;
+    void run_();
+    void write_(Snapshot const& current, Snapshot const& earlier);
+
+    std::string const filename_;
+    bool const json_;
+    std::chrono::duration<double> const interval_;
+    std::int64_t const window_;
+    std::size_t const nschedules_;
+    std::unique_ptr<ScheduleData[]> schedules_;
+    std::atomic<std::uint64_t> events_{};
+
+    // Fixed at the beginning of the job.  Replicated modules share a
+    // label, and so an index, but each has its own description.
+    std::vector<std::string> labels_{};
+    std::unordered_map<std::string, std::size_t> moduleIndices_{};
+    std::vector<std::size_t> indexOfModule_{}; // by ModuleDescription::id()
+    std::unique_ptr<detail::LatencyHistogram[]> latencies_{};
+    std::unique_ptr<detail::LatencyHistogram[]> writeLatencies_{};
+    std::unique_ptr<std::atomic<std::int64_t>[]> moduleStarts_{};
+    std::unique_ptr<std::atomic<std::int64_t>[]> writeStarts_{};
+
+    // Used only by the writing thread.
+    std::deque<Snapshot> history_{};
+#ifdef __linux__
+    std::unique_ptr<LinuxProcMgr> procInfo_{};
+#endif
+
+    std::mutex mutex_{};
+    std::condition_variable cv_{};
+    bool stopping_{false};
+    std::thread thread_{};
+  };
+
+  ProcessingMonitor::ProcessingMonitor(Parameters const& config,
+                                       ActivityRegistry& areg)
+    : filename_{config().filename()}
+    , json_{config().format() == "json"}
+    , interval_{config().interval()}
+    , window_{static_cast<std::int64_t>(config().window() * 1.e9)}
+    , nschedules_{Globals::instance()->nschedules()}
+    , schedules_{std::make_unique<ScheduleData[]>(nschedules_)}
+  {
+    if (!json_ && config().format() != "prometheus") {
+      throw Exception{errors::Configuration}
+        << "ProcessingMonitor: the format must be \"prometheus\" or "
+           "\"json\", not \""
+        << config().format() << "\".\n";
+    }
+    if (config().interval() <= 0.) {
+      throw Exception{errors::Configuration}
+        << "ProcessingMonitor: the interval must be positive.\n";
+    }
+    areg.sPostModuleConstruction.watch(
+      this, &ProcessingMonitor::postModuleConstruction);
+    areg.sPostBeginJob.watch(this, &ProcessingMonitor::postBeginJob);
+    areg.sPostEndJob.watch(this, &ProcessingMonitor::postEndJob);
+    areg.sPreSourceEvent.watch(this, &ProcessingMonitor::preSourceEvent);
+    areg.sPostSourceEvent.watch(this, &ProcessingMonitor::postSourceEvent);
+    areg.sPostProcessEvent.watch(this, &ProcessingMonitor::postProcessEvent);
+    areg.sPreModule.watch(this, &ProcessingMonitor::preModule);
+    areg.sPostModule.watch(this, &ProcessingMonitor::postModule);
+    areg.sPreWriteEvent.watch(this, &ProcessingMonitor::preWriteEvent);
+    areg.sPostWriteEvent.watch(this, &ProcessingMonitor::postWriteEvent);
+  }
+
+  ProcessingMonitor::~ProcessingMonitor()
+  {
+    if (thread_.joinable()) {
+      {
+        std::lock_guard lock{mutex_};
+        stopping_ = true;
+      }
+      cv_.notify_one();
+      thread_.join();
+    }
+  }
+
+  // Modules are constructed before the job begins, so that the module
+  // signals need only look up the index of a description's id.
+  void
+  ProcessingMonitor::postModuleConstruction(ModuleDescription const& md)
+  {
+    std::lock_guard lock{mutex_};
+    auto const [it, inserted] =
+      moduleIndices_.emplace(md.moduleLabel(), labels_.size());
+    if (inserted) {
+      labels_.push_back(md.moduleLabel());
+    }
+    auto const id = md.id();
+    if (id == ModuleDescription::invalid_id()) {
+      return;
+    }
+    if (id >= indexOfModule_.size()) {
+      indexOfModule_.resize(id + 1, no_index);
+    }
+    indexOfModule_[id] = it->second;
+  }
+
+  void
+  ProcessingMonitor::postBeginJob()
+  {
+    auto const nmodules = labels_.size();
+    latencies_ = std::make_unique<detail::LatencyHistogram[]>(nmodules);
+    writeLatencies_ = std::make_unique<detail::LatencyHistogram[]>(nmodules);
+    moduleStarts_ =
+      std::make_unique<std::atomic<std::int64_t>[]>(nmodules * nschedules_);
+    writeStarts_ =
+      std::make_unique<std::atomic<std::int64_t>[]>(nmodules * nschedules_);
+    auto const start = now_ns();
+    for (std::size_t i{}; i != nschedules_; ++i) {
+      schedules_[i].lastEnd = start;
+    }
+#ifdef __linux__
+    procInfo_ = std::make_unique<LinuxProcMgr>();
+#endif
+    history_.push_back(snapshot_());
+    thread_ = std::thread{[this] { run_(); }};
+  }
+
+  void
+  ProcessingMonitor::postEndJob()
+  {
+    if (!thread_.joinable()) {
+      return;
+    }
+    {
+      std::lock_guard lock{mutex_};
+      stopping_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+  }
+
+  // An event that was not written must not leave its processing end
+  // behind for the next one.
+  void
+  ProcessingMonitor::preSourceEvent(ScheduleContext const sc)
+  {
+    auto& d = schedules_[sc.id().id()];
+    auto const t = now_ns();
+    d.processEnd.store(-1, std::memory_order_relaxed);
+    add(d.inputWait, t - d.lastEnd.load(std::memory_order_relaxed));
+    d.eventStart.store(t, std::memory_order_relaxed);
+  }
+
+  // Flush events are read but not processed.
+  void
+  ProcessingMonitor::postSourceEvent(Event const& e, ScheduleContext const sc)
+  {
+    if (e.id().isFlush()) {
+      auto& d = schedules_[sc.id().id()];
+      auto const t = now_ns();
+      add(d.busy, t - d.eventStart.load(std::memory_order_relaxed));
+      d.lastEnd.store(t, std::memory_order_relaxed);
+    }
+  }
+
+  void
+  ProcessingMonitor::postProcessEvent(Event const&, ScheduleContext const sc)
+  {
+    auto& d = schedules_[sc.id().id()];
+    auto const t = now_ns();
+    add(d.busy, t - d.eventStart.load(std::memory_order_relaxed));
+    d.processEnd.store(t, std::memory_order_relaxed);
+    d.lastEnd.store(t, std::memory_order_relaxed);
+    events_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  std::size_t
+  ProcessingMonitor::moduleIndex_(ModuleContext const& mc) const
+  {
+    auto const id = mc.moduleDescription().id();
+    if (id >= indexOfModule_.size() || indexOfModule_[id] == no_index) {
+      return labels_.size();
+    }
+    return indexOfModule_[id];
+  }
+
+  // Modules run concurrently within a schedule, so each module has its
+  // own start time per schedule.
+  void
+  ProcessingMonitor::start_(
+    std::unique_ptr<std::atomic<std::int64_t>[]> const& starts,
+    ModuleContext const& mc)
+  {
+    auto const i = moduleIndex_(mc);
+    if (i == labels_.size() || !starts) {
+      return;
+    }
+    starts[mc.scheduleID().id() * labels_.size() + i].store(
+      now_ns(), std::memory_order_relaxed);
+  }
+
+  void
+  ProcessingMonitor::record_(
+    std::unique_ptr<std::atomic<std::int64_t>[]> const& starts,
+    std::unique_ptr<detail::LatencyHistogram[]> const& latencies,
+    ModuleContext const& mc)
+  {
+    auto const i = moduleIndex_(mc);
+    if (i == labels_.size() || !starts) {
+      return;
+    }
+    auto const& start = starts[mc.scheduleID().id() * labels_.size() + i];
+    latencies[i].record(std::chrono::nanoseconds{
+      now_ns() - start.load(std::memory_order_relaxed)});
+  }
+
+  void
+  ProcessingMonitor::preModule(ModuleContext const& mc)
+  {
+    start_(moduleStarts_, mc);
+  }
+
+  void
+  ProcessingMonitor::postModule(ModuleContext const& mc)
+  {
+    record_(moduleStarts_, latencies_, mc);
+  }
+
+  // The writing of an event is serialized across schedules, so the
+  // first write of an event ends its output wait.
+  void
+  ProcessingMonitor::preWriteEvent(ModuleContext const& mc)
+  {
+    auto& d = schedules_[mc.scheduleID().id()];
+    auto const t = now_ns();
+    if (auto const end = d.processEnd.exchange(-1, std::memory_order_relaxed);
+        end != -1) {
+      add(d.outputWait, t - end);
+    }
+    d.writeStart.store(t, std::memory_order_relaxed);
+    start_(writeStarts_, mc);
+  }
+
+  void
+  ProcessingMonitor::postWriteEvent(ModuleContext const& mc)
+  {
+    record_(writeStarts_, writeLatencies_, mc);
+    auto& d = schedules_[mc.scheduleID().id()];
+    auto const t = now_ns();
+    add(d.busy, t - d.writeStart.load(std::memory_order_relaxed));
+    d.lastEnd.store(t, std::memory_order_relaxed);
+  }
+
+  Snapshot
+  ProcessingMonitor::snapshot_() const
+  {
+    Snapshot result{
+      now_ns(), events_.load(std::memory_order_relaxed), {}, {}, {}};
+    result.schedules.reserve(nschedules_);
+    for (std::size_t i{}; i != nschedules_; ++i) {
+      auto const& d = schedules_[i];
+      result.schedules.push_back(
+        {d.busy.load(std::memory_order_relaxed),
+         d.inputWait.load(std::memory_order_relaxed),
+         d.outputWait.load(std::memory_order_relaxed)});
+    }
+    result.modules.reserve(labels_.size());
+    result.writes.reserve(labels_.size());
+    for (std::size_t i{}; i != labels_.size(); ++i) {
+      result.modules.push_back(latencies_[i].counts());
+      result.writes.push_back(writeLatencies_[i].counts());
+    }
+    return result;
+  }
+
+  void
+  ProcessingMonitor::run_()
+  {
+    std::unique_lock lock{mutex_};
+    while (true) {
+      bool const stopping =
+        cv_.wait_for(lock, interval_, [this] { return stopping_; });
+      lock.unlock();
+      auto current = snapshot_();
+      // Keep the latest snapshot that is at least a window old as the
+      // baseline.
+      while (history_.size() > 1 &&
+             current.time - history_[1].time >= window_) {
+        history_.pop_front();
+      }
+      try {
+        write_(current, history_.front());
+      }
+      catch (std::exception const& e) {
+        mf::LogWarning("ProcessingMonitor")
+          << "Could not write " << filename_ << ": " << e.what();
+      }
+      history_.push_back(std::move(current));
+      if (stopping) {
+        return;
+      }
+      lock.lock();
+    }
+  }
+
+  void
+  ProcessingMonitor::write_(Snapshot const& current, Snapshot const& earlier)
+  {
+    using detail::LatencyHistogram;
+    double const seconds =
+      std::max(1.e-9 * (current.time - earlier.time), 1.e-9);
+    double const rate = (current.events - earlier.events) / seconds;
+    double rss{-1.};
+#ifdef __linux__
+    rss = std::get<LinuxProcData::rss_t>(procInfo_->getCurrentData()).value;
+#endif
+
+    struct Fractions {
+      double idle;
+      double inputWait;
+      double outputWait;
+    };
+    std::vector<Fractions> fractions;
+    for (std::size_t i{}; i != current.schedules.size(); ++i) {
+      auto const& c = current.schedules[i];
+      auto const& e = earlier.schedules[i];
+      fractions.push_back(
+        {std::max(0., 1. - 1.e-9 * (c.busy - e.busy) / seconds),
+         1.e-9 * (c.inputWait - e.inputWait) / seconds,
+         1.e-9 * (c.outputWait - e.outputWait) / seconds});
+    }
+
+    // Only modules that have seen an event, or written one, are listed.
+    struct Latency {
+      std::string name;
+      double p50;
+      double p99;
+    };
+    std::vector<Latency> latencies;
+    auto add_latencies = [this, &latencies](auto const& later,
+                                            auto const& before,
+                                            std::string const& suffix) {
+      for (std::size_t i{}; i != labels_.size(); ++i) {
+        auto const& counts = later[i];
+        if (std::all_of(counts.cbegin(), counts.cend(), [](auto const n) {
+              return n == 0;
+            })) {
+          continue;
+        }
+        latencies.push_back(
+          {labels_[i] + suffix,
+           LatencyHistogram::quantile(counts, before[i], 0.5),
+           LatencyHistogram::quantile(counts, before[i], 0.99)});
+      }
+    };
+    add_latencies(current.modules, earlier.modules, "");
+    add_latencies(current.writes, earlier.writes, "(write)");
+
+    std::ostringstream os;
+    os << std::setprecision(6);
+    if (json_) {
+      os << "{\"time\":"
+         << std::chrono::duration_cast<std::chrono::seconds>(
+              std::chrono::system_clock::now().time_since_epoch())
+              .count()
+         << ",\"window\":" << seconds << ",\"events\":" << current.events
+         << ",\"events_per_second\":" << rate;
+      if (rss >= 0.) {
+        os << ",\"rss_bytes\":" << rss;
+      }
+      os << ",\"schedules\":[";
+      for (std::size_t i{}; i != fractions.size(); ++i) {
+        os << (i ? "," : "") << "{\"schedule\":" << i
+           << ",\"idle_fraction\":" << fractions[i].idle
+           << ",\"input_wait_fraction\":" << fractions[i].inputWait
+           << ",\"output_wait_fraction\":" << fractions[i].outputWait << '}';
+      }
+      os << "],\"modules\":{";
+      for (std::size_t i{}; i != latencies.size(); ++i) {
+        os << (i ? "," : "") << quoted(latencies[i].name)
+           << ":{\"p50\":" << latencies[i].p50
+           << ",\"p99\":" << latencies[i].p99 << '}';
+      }
+      os << "}}\n";
+      // One write per line, so that a reader never sees part of one.
+      std::ofstream out{filename_, std::ios::app};
+      out << os.str() << std::flush;
+      if (!out) {
+        throw std::runtime_error{"write failed"};
+      }
+      return;
+    }
+
+    os << "# TYPE art_events_total counter\n"
+       << "art_events_total " << current.events << '\n'
+       << "# TYPE art_events_per_second gauge\n"
+       << "art_events_per_second " << rate << '\n';
+    if (rss >= 0.) {
+      os << "# TYPE art_rss_bytes gauge\n"
+         << "art_rss_bytes " << rss << '\n';
+    }
+    auto schedule_metric = [&os, &fractions](std::string const& name,
+                                             double Fractions::*fraction) {
+      os << "# TYPE art_schedule_" << name << "_fraction gauge\n";
+      for (std::size_t i{}; i != fractions.size(); ++i) {
+        os << "art_schedule_" << name << "_fraction{schedule=\"" << i
+           << "\"} " << fractions[i].*fraction << '\n';
+      }
+    };
+    schedule_metric("idle", &Fractions::idle);
+    schedule_metric("input_wait", &Fractions::inputWait);
+    schedule_metric("output_wait", &Fractions::outputWait);
+    os << "# TYPE art_module_latency_seconds gauge\n";
+    for (auto const& latency : latencies) {
+      for (auto const& [q, value] :
+           {std::pair{"0.5", latency.p50}, std::pair{"0.99", latency.p99}}) {
+        os << "art_module_latency_seconds{module=" << quoted(latency.name)
+           << ",quantile=\"" << q << "\"} " << value << '\n';
+      }
+    }
+
+    // Written aside and renamed, so that a reader never sees a partial
+    // file.
+    auto const tmp = filename_ + '.' + std::to_string(getpid());
+    {
+      std::ofstream out{tmp};
+      out << os.str();
+      if (!out) {
+        std::remove(tmp.c_str());
+        throw std::runtime_error{"write failed"};
+      }
+    }
+    if (std::rename(tmp.c_str(), filename_.c_str()) != 0) {
+      std::remove(tmp.c_str());
+      throw std::runtime_error{"rename failed"};
+    }
+  }
+
+} // namespace art
+
+DECLARE_ART_SERVICE(art::ProcessingMonitor, SHARED)
+DEFINE_ART_SERVICE(art::ProcessingMonitor)
@@ -150,6 +150,16 @@ namespace art {
         << "Attempt to create engine with out-of-range ScheduleID: " << sid
         << '\n';
     }
+    // The engines are saved and restored per schedule, which cannot be
+    // done while another schedule is using the same module copy.
+    if (Globals::instance()->nreplicas() != data_.size()) {
+      throw cet::exception("RANDOM")
+        << "RNGservice::createEngine():\n"
+        << "Attempt to create engine \"" << engine_label << "\" for module \""
+        << module_label << "\", whose copies are shared by several\n"
+        << "schedules.  Please remove 'services.scheduler.num_replicas' "
+           "from the configuration.\n";
+    }
     string const& label = qualify_engine_label(sid, module_label, engine_label);
     if (data_[sid].tracker_.find(label) != data_[sid].tracker_.cend()) {
       throw cet::exception("RANDOM")
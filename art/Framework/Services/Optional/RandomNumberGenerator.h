@@ -129,7 +129,7 @@
 #include "CLHEP/Random/RandomEngine.h"
 #include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
 #include "art/Framework/Services/Registry/ServiceTable.h"
-#include "art/Utilities/PerScheduleContainer.h"
+#include "art/Utilities/PaddedPerScheduleContainer.h"
 #include "art/Utilities/ScheduleID.h"
 #include "canvas/Persistency/Common/RNGsnapshot.h"
 #include "fhiclcpp/types/Atom.h"
@@ -318,7 +318,7 @@ namespace art {
       // The random engine number state snapshots taken for this stream.
       std::vector<RNGsnapshot> snapshot_{};
     };
-    PerScheduleContainer<ScheduleData> data_;
+    PaddedPerScheduleContainer<ScheduleData> data_;
   };
 
 } // namespace art
@@ -0,0 +1,106 @@
+#ifndef art_Framework_Services_Optional_detail_LatencyHistogram_h
+#define art_Framework_Services_Optional_detail_LatencyHistogram_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// LatencyHistogram
+//
+// A histogram of durations with logarithmic bins--four per factor of
+// two, from 1 microsecond to about an hour--that may be filled from
+// any number of threads without locking.  Quantiles are computed from
+// the difference of two sets of counts, so that a reader can follow a
+// rolling window by keeping earlier copies of the counts.
+// ======================================================================
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace art::detail {
+
+  class LatencyHistogram {
+  public:
+    static constexpr std::size_t nbins{128};
+    using counts_t = std::array<std::uint64_t, nbins>;
+
+    void
+    record(std::chrono::nanoseconds const d) noexcept
+    {
+      counts_[bin(d)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    counts_t
+    counts() const noexcept
+    {
+      counts_t result;
+      for (std::size_t i{}; i != nbins; ++i) {
+        result[i] = counts_[i].load(std::memory_order_relaxed);
+      }
+      return result;
+    }
+
+    static std::size_t
+    bin(std::chrono::nanoseconds const d) noexcept
+    {
+      auto const us = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+      if (d.count() <= 0 || us == 0) {
+        return 0;
+      }
+      auto const msb = 63u - static_cast<unsigned>(__builtin_clzll(us));
+      auto const quarter =
+        msb >= 2 ? (us >> (msb - 2)) & 3u : (us << (2 - msb)) & 3u;
+      auto const result = 1u + 4u * msb + quarter;
+      return result < nbins ? result : nbins - 1;
+    }
+
+    // In seconds.
+    static double
+    upperEdge(std::size_t const bin) noexcept
+    {
+      if (bin == 0) {
+        return 1.e-6;
+      }
+      auto const msb = (bin - 1) / 4;
+      auto const quarter = (bin - 1) % 4;
+      return std::ldexp(1. + (quarter + 1) / 4., static_cast<int>(msb)) *
+             1.e-6;
+    }
+
+    // The upper edge of the bin holding the q-quantile of the entries
+    // counted between 'earlier' and 'later'; 0 if there are none.
+    static double
+    quantile(counts_t const& later, counts_t const& earlier, double const q)
+    {
+      std::uint64_t total{};
+      for (std::size_t i{}; i != nbins; ++i) {
+        total += later[i] - earlier[i];
+      }
+      if (total == 0) {
+        return 0.;
+      }
+      auto const rank = static_cast<std::uint64_t>(std::ceil(q * total));
+      std::uint64_t seen{};
+      for (std::size_t i{}; i != nbins; ++i) {
+        seen += later[i] - earlier[i];
+        if (seen >= rank && seen != 0) {
+          return upperEdge(i);
+        }
+      }
+      return upperEdge(nbins - 1);
+    }
+
+  private:
+    std::array<std::atomic<std::uint64_t>, nbins> counts_{};
+  };
+
+} // namespace art::detail
+
+#endif /* art_Framework_Services_Optional_detail_LatencyHistogram_h */
+
+// Local Variables:
+// mode: c++
+// End:
@@ -30,6 +30,23 @@ namespace art {
     {
       return cet::search_all(s, oldToNew(md));
     }
+
+    void
+    check_syntax(string const& key, string const& value)
+    {
+      string checkString("{ ");
+      checkString += cet::canonical_string(key) + " : " + value + " }";
+      boost::json::error_code ec;
+      boost::json::parser p;
+      auto const n_parsed_chars = p.write_some(checkString, ec);
+      if (ec) {
+        throw Exception(errors::DataCorruption)
+          << "FileCatalogMetadata::addMetadata() JSON " << ec.message() << ":\n"
+          << "Faulty key/value clause:\n"
+          << checkString << '\n'
+          << (n_parsed_chars ? string(n_parsed_chars, '-') : "") << "^\n";
+      }
+    }
   } // unnamed namespace
 
   FileCatalogMetadata::FileCatalogMetadata(
@@ -78,18 +95,7 @@ namespace art {
   FileCatalogMetadata::addMetadata(string const& key, string const& value)
   {
     if (checkSyntax_) {
-      string checkString("{ ");
-      checkString += cet::canonical_string(key) + " : " + value + " }";
-      boost::json::error_code ec;
-      boost::json::parser p;
-      auto const n_parsed_chars = p.write_some(checkString, ec);
-      if (ec) {
-        throw Exception(errors::DataCorruption)
-          << "FileCatalogMetadata::addMetadata() JSON " << ec.message() << ":\n"
-          << "Faulty key/value clause:\n"
-          << checkString << '\n'
-          << (n_parsed_chars ? string(n_parsed_chars, '-') : "") << "^\n";
-      }
+      check_syntax(key, value);
     }
     std::lock_guard sentry{mutex_};
     md_.emplace_back(key, value);
@@ -103,13 +109,20 @@ namespace art {
     }
 
     std::lock_guard sentry{mutex_};
-    if (!imd_) {
-      imd_ = make_unique<InheritedMetadata>(mdToInherit_, mdFromInput);
-    } else {
+    if (imd_) {
+      // The inherited values were recorded when the first input file
+      // was opened; later files need only agree with them.
       imd_->check_values(mdFromInput);
+      return;
     }
+    imd_ = make_unique<InheritedMetadata>(mdToInherit_, mdFromInput);
     for (auto const& [key, value] : imd_->entries()) {
-      addMetadataString(oldToNew(key), value);
+      auto const newKey = oldToNew(key);
+      auto const newValue = cet::canonical_string(value);
+      if (checkSyntax_) {
+        check_syntax(newKey, newValue);
+      }
+      md_.emplace_back(newKey, newValue);
     }
   }
 
@@ -129,7 +129,7 @@ namespace art {
 
   private:
     // Protects all data members.
-    mutable std::recursive_mutex mutex_{};
+    mutable std::mutex mutex_{};
 
     // Whether or not the user wishes metadata to be checked for syntax by
     // parsing with a JSON parser.
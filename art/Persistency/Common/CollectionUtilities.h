@@ -66,13 +66,32 @@
 // PtrRemapper). This function is only useful in the (hopefully rare)
 // case that one has a Ptr *into* a PtrVector.
 //
+// flattenCollectionsInParallel(...)
+//
+// Equivalent to 1. and 2. above, respectively:
+//
+// 5.   flattenCollectionsInParallel(in, out)
+//
+// 6.   flattenCollectionsInParallel(in, out, offsets)
+//
+// The offset of each input collection within the output is computed
+// once, the output is resized to its final size, and the elements
+// are then copied into place concurrently (using TBB).  This is only
+// possible for contiguous, resizable collections of
+// default-constructible elements (e.g. std::vector<T>); for any other
+// collection (including PtrVector and cet::map_vector), these
+// functions fall back to the serial implementations.
+//
 ////////////////////////////////////////////////////////////////////////
 
 #include "canvas/Persistency/Common/Ptr.h"
 #include "canvas/Persistency/Common/PtrVector.h"
 #include "canvas/Persistency/Provenance/ProductID.h"
 #include "cetlib/map_vector.h"
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <type_traits>
 #include <utility>
@@ -107,6 +126,17 @@ namespace art {
   void flattenCollections(std::vector<PtrVector<T> const*> const& in,
                           PtrVector<T>& out,
                           OFFSETS& offsets);
+
+  // 5.
+  template <typename COLLECTION>
+  void flattenCollectionsInParallel(std::vector<COLLECTION const*> const& in,
+                                    COLLECTION& out);
+
+  // 6.
+  template <typename COLLECTION, typename OFFSETS>
+  void flattenCollectionsInParallel(std::vector<COLLECTION const*> const& in,
+                                    COLLECTION& out,
+                                    OFFSETS& offsets);
 } // namespace art
 
 ////////////////////////////////////////////////////////////////////////
@@ -247,6 +277,97 @@ namespace art::detail {
     has_three_arg_insert_t<T, typename T::iterator>::value ||
     has_three_arg_insert_t<T, typename T::const_iterator>::value;
 
+  // Parallel flattening requires contiguous, resizable storage of
+  // default-constructible elements.  PtrVector and map_vector
+  // maintain additional state when elements are inserted, so they are
+  // always flattened serially.
+  template <typename T, typename = void>
+  struct supports_parallel_flatten : std::false_type {};
+
+  template <typename T>
+  struct supports_parallel_flatten<
+    T,
+    std::void_t<decltype(std::declval<T&>().resize(std::size_t{})),
+                decltype(std::declval<T&>().data())>>
+    : std::is_default_constructible<typename T::value_type> {};
+
+  template <typename T>
+  struct supports_parallel_flatten<PtrVector<T>> : std::false_type {};
+
+  template <typename T>
+  struct supports_parallel_flatten<cet::map_vector<T>> : std::false_type {};
+
+  // The number of output elements handled by one TBB task.
+  constexpr std::size_t parallel_flatten_grain_size{1 << 14};
+
+  // Invokes f(i, b, e, d) concurrently such that, taken together, the
+  // calls cover every element exactly once: elements [b, e) of input
+  // collection i belong at position d of the flattened output.
+  // 'starts' holds the output position of the first element of each
+  // input collection, and 'total' the size of the flattened output.
+  template <typename F>
+  void
+  parallel_for_segments(std::vector<std::size_t> const& starts,
+                        std::size_t const total,
+                        F f)
+  {
+    auto const n = starts.size();
+    tbb::parallel_for(
+      tbb::blocked_range<std::size_t>{0, total, parallel_flatten_grain_size},
+      [&starts, n, total, &f](auto const& r) {
+        auto d = r.begin();
+        // The last collection starting at or before d.
+        std::size_t i =
+          std::upper_bound(starts.cbegin(), starts.cend(), d) -
+          starts.cbegin() - 1;
+        while (d != r.end()) {
+          auto const start = starts[i];
+          auto const stop = (i + 1 == n) ? total : starts[i + 1];
+          auto const e = std::min(stop, r.end());
+          if (e != d) {
+            f(i, d - start, e - start, d);
+          }
+          d = e;
+          ++i;
+        }
+      });
+  }
+
+  template <typename COLLECTION>
+  void
+  parallel_flatten(std::vector<COLLECTION const*> const& in, COLLECTION& out)
+  {
+    std::vector<COLLECTION const*> colls;
+    std::vector<std::size_t> starts;
+    colls.reserve(in.size());
+    starts.reserve(in.size());
+    std::size_t total{};
+    for (auto collptr : in) {
+      if (collptr == nullptr) {
+        continue;
+      }
+      colls.push_back(collptr);
+      starts.push_back(total);
+      total += collptr->size();
+    }
+    if (total == 0) {
+      return;
+    }
+    auto const base = out.size();
+    out.resize(base + total);
+    auto* const dest = out.data() + base;
+    parallel_for_segments(
+      starts,
+      total,
+      [&colls, dest](std::size_t const i,
+                     std::size_t const b,
+                     std::size_t const e,
+                     std::size_t const d) {
+        auto const src = colls[i]->begin();
+        std::copy(src + b, src + e, dest + d);
+      });
+  }
+
 } // namespace art::detail
 
 template <typename CONTAINER>
@@ -335,6 +456,43 @@ art::flattenCollections(std::vector<PtrVector<T> const*> const& in,
   flattenCollections<PtrVector<T>>(in, out, offsets); // 2.
 }
 
+// 5.
+template <typename COLLECTION>
+void
+art::flattenCollectionsInParallel(std::vector<COLLECTION const*> const& in,
+                                  COLLECTION& out)
+{
+  if constexpr (detail::supports_parallel_flatten<COLLECTION>::value) {
+    detail::parallel_flatten(in, out);
+  } else {
+    flattenCollections(in, out); // 1. or 3.
+  }
+}
+
+// 6.
+template <typename COLLECTION, typename OFFSETS>
+void
+art::flattenCollectionsInParallel(std::vector<COLLECTION const*> const& in,
+                                  COLLECTION& out,
+                                  OFFSETS& offsets)
+{
+  if constexpr (detail::supports_parallel_flatten<COLLECTION>::value) {
+    offsets.clear();
+    offsets.reserve(in.size());
+    typename COLLECTION::size_type current_offset{};
+    for (auto collptr : in) {
+      if (collptr == nullptr)
+        continue;
+      auto const delta = detail::mix_offset<COLLECTION>::offset(*collptr);
+      offsets.push_back(current_offset);
+      current_offset += delta;
+    }
+    detail::parallel_flatten(in, out);
+  } else {
+    flattenCollections(in, out, offsets); // 2. or 4.
+  }
+}
+
 #endif /* art_Persistency_Common_CollectionUtilities_h */
 
 // Local Variables:
@@ -4,12 +4,22 @@
 #include "canvas/Persistency/Provenance/ProcessConfiguration.h"
 #include "fhiclcpp/ParameterSetID.h"
 
+#include <atomic>
 #include <ostream>
 
 using namespace std;
 
 namespace art {
 
+  namespace {
+    unsigned
+    next_id()
+    {
+      static atomic<unsigned> id{};
+      return id++;
+    }
+  }
+
   ModuleDescription::~ModuleDescription() = default;
   ModuleDescription::ModuleDescription() = default;
 
@@ -25,6 +35,7 @@ namespace art {
     , moduleLabel_{modLabel}
     , moduleThreadingType_{moduleThreadingType}
     , isEmulated_{isEmulated}
+    , id_{next_id()}
     , processConfiguration_{std::move(pc)}
   {}
 
@@ -88,6 +99,12 @@ namespace art {
     return processConfiguration().parameterSetID();
   }
 
+  unsigned
+  ModuleDescription::id() const
+  {
+    return id_;
+  }
+
   bool
   ModuleDescription::operator<(ModuleDescription const& rh) const
   {
@@ -37,6 +37,16 @@ namespace art {
     std::string const& releaseVersion() const;
     fhicl::ParameterSetID const& mainParameterSetID() const;
 
+    // A small number that identifies the module description within the
+    // process.  It is assigned when the description is made, and is
+    // kept by its copies; it is not part of the description's value.
+    static constexpr unsigned
+    invalid_id()
+    {
+      return -1u;
+    }
+    unsigned id() const;
+
     bool operator<(ModuleDescription const& rh) const;
     bool operator==(ModuleDescription const& rh) const;
     bool operator!=(ModuleDescription const& rh) const;
@@ -48,6 +58,7 @@ namespace art {
     std::string moduleLabel_{};
     ModuleThreadingType moduleThreadingType_{};
     bool isEmulated_{false};
+    unsigned id_{invalid_id()};
 
     // Process-wide configuration
     ProcessConfiguration processConfiguration_{"invalid_process",
@@ -0,0 +1,113 @@
+#include "art/Persistency/Provenance/ProcessHistoryCache.h"
+// vim: set sw=2 expandtab :
+
+#include "art/Persistency/Provenance/ProcessHistoryRegistry.h"
+#include "fhiclcpp/ParameterSetID.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+
+namespace art {
+
+  namespace {
+
+    // Extensions are keyed by the ID of the original history and by
+    // everything that distinguishes one process configuration from
+    // another.
+    using extension_key_t = std::
+      tuple<ProcessHistoryID, std::string, fhicl::ParameterSetID, std::string>;
+
+    using history_ptr = std::shared_ptr<ProcessHistory const>;
+
+    // An extended history is also entered in 'histories', for the
+    // principals whose source provides its ID.
+    struct Cache {
+      std::shared_mutex mutex;
+      std::map<ProcessHistoryID, history_ptr> histories;
+      std::map<extension_key_t, history_ptr, std::less<>> extensions;
+    };
+
+    Cache&
+    cache()
+    {
+      static Cache result;
+      return result;
+    }
+
+    history_ptr
+    published(ProcessHistory history)
+    {
+      // Computing the ID now avoids its being computed lazily--and
+      // concurrently--by the readers.
+      history.id();
+      return std::make_shared<ProcessHistory const>(std::move(history));
+    }
+
+    ProcessHistory const&
+    empty_history()
+    {
+      static auto const result = published(ProcessHistory{});
+      return *result;
+    }
+
+  } // unnamed namespace
+
+  ProcessHistory const*
+  ProcessHistoryCache::get(ProcessHistoryID const& id)
+  {
+    if (!id.isValid()) {
+      return &empty_history();
+    }
+    auto& c = cache();
+    {
+      std::shared_lock lock{c.mutex};
+      if (auto it = c.histories.find(id); it != c.histories.cend()) {
+        return it->second.get();
+      }
+    }
+    ProcessHistory history;
+    if (!ProcessHistoryRegistry::get(id, history)) {
+      return nullptr;
+    }
+    std::lock_guard lock{c.mutex};
+    auto& entry = c.histories[id];
+    if (!entry) {
+      entry = published(std::move(history));
+    }
+    return entry.get();
+  }
+
+  ProcessHistory const&
+  ProcessHistoryCache::extend(ProcessHistory const& history,
+                              ProcessConfiguration const& pc)
+  {
+    auto const key = std::tie(history.id(),
+                              pc.processName(),
+                              pc.parameterSetID(),
+                              pc.releaseVersion());
+    auto& c = cache();
+    {
+      std::shared_lock lock{c.mutex};
+      if (auto it = c.extensions.find(key); it != c.extensions.cend()) {
+        return *it->second;
+      }
+    }
+    ProcessHistory extended{history};
+    extended.push_back(pc);
+    auto result = published(std::move(extended));
+    ProcessHistoryRegistry::emplace(result->id(), *result);
+    std::lock_guard lock{c.mutex};
+    auto& entry = c.extensions[extension_key_t{key}];
+    if (!entry) {
+      entry = std::move(result);
+      c.histories.try_emplace(entry->id(), entry);
+    }
+    return *entry;
+  }
+
+} // namespace art
@@ -0,0 +1,43 @@
+#ifndef art_Persistency_Provenance_ProcessHistoryCache_h
+#define art_Persistency_Provenance_ProcessHistoryCache_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// ProcessHistoryCache
+//
+// Shared, immutable copies of the process histories in the
+// ProcessHistoryRegistry, and of their extensions by the current
+// process.  A job sees only a handful of distinct histories, so
+// principals refer to the cached copies instead of each fetching,
+// extending, hashing and registering its own.
+//
+// The cached histories live until the end of the job, and their IDs
+// are computed before they are handed out, so that they may be read
+// from any thread without locking.
+// ======================================================================
+
+#include "canvas/Persistency/Provenance/ProcessConfiguration.h"
+#include "canvas/Persistency/Provenance/ProcessHistory.h"
+#include "canvas/Persistency/Provenance/ProcessHistoryID.h"
+
+namespace art {
+
+  class ProcessHistoryCache {
+  public:
+    // The empty history for an invalid ID; nullptr if a valid ID is
+    // not in the ProcessHistoryRegistry.
+    static ProcessHistory const* get(ProcessHistoryID const& id);
+
+    // The given cached history, followed by the given process.  The
+    // extended history is also placed in the ProcessHistoryRegistry.
+    static ProcessHistory const& extend(ProcessHistory const& history,
+                                        ProcessConfiguration const& pc);
+  };
+
+} // namespace art
+
+#endif /* art_Persistency_Provenance_ProcessHistoryCache_h */
+
+// Local Variables:
+// mode: c++
+// End:
@@ -0,0 +1,42 @@
+#ifndef art_Utilities_CacheLinePadded_h
+#define art_Utilities_CacheLinePadded_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// CacheLinePadded<T> wraps an object of type T so that it occupies (at
+// least) one full cache line of its own.  Arrays of such objects can
+// be written to concurrently from different threads without false
+// sharing between adjacent elements.
+//
+// We do not use std::hardware_destructive_interference_size since its
+// value may depend on the compiler flags used for a given translation
+// unit, which makes it unsuitable for use in a header.
+// ======================================================================
+
+#include <cstddef>
+#include <utility>
+
+namespace art {
+  namespace detail {
+    inline constexpr std::size_t cache_line_size{64};
+  }
+
+  template <typename T>
+  struct alignas(detail::cache_line_size) CacheLinePadded {
+    CacheLinePadded() = default;
+
+    template <typename... Args>
+    explicit CacheLinePadded(std::in_place_t, Args&&... args)
+      : value(std::forward<Args>(args)...)
+    {}
+
+    T value{};
+  };
+
+} // namespace art
+
+#endif /* art_Utilities_CacheLinePadded_h */
+
+// Local Variables:
+// mode: c++
+// End:
@@ -1,10 +1,37 @@
 #include "art/Utilities/GlobalTaskGroup.h"
 
+#include "tbb/info.h"
+
 art::GlobalTaskGroup::GlobalTaskGroup(unsigned const n_threads,
-                                      unsigned const stack_size)
+                                      unsigned const stack_size,
+                                      bool const numa_placement)
   : threadControl_{tbb::global_control::max_allowed_parallelism, n_threads}
   , stackSizeControl_{tbb::global_control::thread_stack_size, stack_size}
-{}
+{
+  if (!numa_placement) {
+    return;
+  }
+  // Without the TBB/hwloc binding library, TBB reports a single node
+  // with an id of -1, in which case there is nothing to place.
+  auto const nodes = tbb::info::numa_nodes();
+  if (nodes.size() < 2) {
+    return;
+  }
+  // The main thread waits outside of the arenas, so each arena needs
+  // at least one worker thread of its own.
+  if (n_threads != 0 && n_threads <= nodes.size()) {
+    return;
+  }
+  // The threads are shared evenly among the nodes.
+  int const per_node =
+    n_threads == 0 ? tbb::task_arena::automatic :
+                     static_cast<int>((n_threads + nodes.size() - 1) /
+                                      nodes.size());
+  for (auto const node : nodes) {
+    tbb::task_arena::constraints const c{node, per_node};
+    arenas_.push_back(std::make_unique<tbb::task_arena>(c, 0));
+  }
+}
 
 void
 art::GlobalTaskGroup::may_run(hep::concurrency::WaitingTaskPtr task,
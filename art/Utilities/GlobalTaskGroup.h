@@ -1,16 +1,26 @@
 #ifndef art_Utilities_GlobalTaskGroup_h
 #define art_Utilities_GlobalTaskGroup_h
 
+#include "art/Utilities/ScheduleID.h"
 #include "hep_concurrency/WaitingTask.h"
 #include "tbb/global_control.h"
+#include "tbb/task_arena.h"
 #include "tbb/task_group.h"
 
 #include <exception>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace art {
   class GlobalTaskGroup {
   public:
-    GlobalTaskGroup(unsigned n_threads, unsigned stack_size);
+    // If 'numa_placement' is true and TBB reports more than one NUMA
+    // node, one task arena is created per node, its threads are bound
+    // to that node, and each schedule is assigned to one of them.
+    GlobalTaskGroup(unsigned n_threads,
+                    unsigned stack_size,
+                    bool numa_placement = false);
 
     template <typename T>
     void
@@ -19,9 +29,60 @@ namespace art {
       group_.run(std::move(t));
     }
 
+    // Runs the task in the arena of the given schedule, if any.  The
+    // tasks it spawns stay in that arena.  Tasks launched from another
+    // arena--e.g. those of a serial task queue released by another
+    // schedule--run in that other arena, and so possibly on another
+    // node.  The task is enqueued without waiting to enter the arena,
+    // so that a thread of another arena never blocks here.
+    template <typename T>
+    void
+    run(ScheduleID const sid, T&& t)
+    {
+      if (arenas_.empty()) {
+        group_.run(std::forward<T>(t));
+        return;
+      }
+      arena_(sid).enqueue(group_.defer(std::forward<T>(t)));
+    }
+
+    // Calls 'f' in the arena of the given schedule, if any, waits for
+    // it, and returns its result.  The memory that 'f' allocates and
+    // first touches is thus placed on the schedule's node.
+    template <typename F>
+    decltype(auto)
+    execute(ScheduleID const sid, F&& f)
+    {
+      if (arenas_.empty()) {
+        return std::forward<F>(f)();
+      }
+      return arena_(sid).execute(std::forward<F>(f));
+    }
+
+    std::size_t
+    n_arenas() const noexcept
+    {
+      return arenas_.size();
+    }
+
+    // The index of the arena of the given schedule, or 0 if there are
+    // no arenas.
+    std::size_t
+    arena_index(ScheduleID const sid) const noexcept
+    {
+      return arenas_.empty() ? 0 : sid.id() % arenas_.size();
+    }
+
     void may_run(hep::concurrency::WaitingTaskPtr task,
                  std::exception_ptr ex_ptr = {});
 
+    // Waits until all tasks run by the group have finished.
+    void
+    wait()
+    {
+      group_.wait();
+    }
+
     // Get rid of this!
     tbb::task_group&
     native_group()
@@ -30,9 +91,16 @@ namespace art {
     }
 
   private:
+    tbb::task_arena&
+    arena_(ScheduleID const sid) const
+    {
+      return *arenas_[arena_index(sid)];
+    }
+
     tbb::global_control threadControl_;
     tbb::global_control stackSizeControl_;
     tbb::task_group group_;
+    std::vector<std::unique_ptr<tbb::task_arena>> arenas_{};
   };
 }
 
@@ -44,6 +44,46 @@ namespace art {
     nthreads_ = nthreads;
   }
 
+  // Unless set otherwise, one copy per schedule.
+  ScheduleID::size_type
+  Globals::nreplicas() const
+  {
+    if (nreplicas_ < 1 || nreplicas_ > nschedules_) {
+      return nschedules_;
+    }
+    return nreplicas_;
+  }
+
+  void
+  Globals::setNReplicas(int const nreplicas)
+  {
+    nreplicas_ = nreplicas;
+  }
+
+  unsigned
+  Globals::nprocesses() const
+  {
+    return nprocesses_;
+  }
+
+  void
+  Globals::setNProcesses(unsigned const nprocesses)
+  {
+    nprocesses_ = nprocesses;
+  }
+
+  unsigned
+  Globals::processIndex() const
+  {
+    return processIndex_;
+  }
+
+  void
+  Globals::setProcessIndex(unsigned const index)
+  {
+    processIndex_ = index;
+  }
+
   string const&
   Globals::processName() const
   {
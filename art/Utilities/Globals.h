@@ -11,6 +11,7 @@
 namespace art {
 
   class Globals {
+    friend class EventProcessor;
     friend class PathManager;
     friend class Scheduler;
 
@@ -24,6 +25,13 @@ namespace art {
     static Globals* instance();
     ScheduleID::size_type nschedules() const;
     ScheduleID::size_type nthreads() const;
+    // The number of copies made of each replicated module, which the
+    // schedules share round-robin when it is smaller than nschedules().
+    ScheduleID::size_type nreplicas() const;
+    // The number of processes among which the input is divided, and
+    // the index of the current one (always 0 for a single process).
+    unsigned nprocesses() const;
+    unsigned processIndex() const;
     std::string const& processName() const;
     fhicl::ParameterSet const& triggerPSet() const;
     std::vector<std::string> const& triggerPathNames() const;
@@ -33,12 +41,18 @@ namespace art {
 
     void setNSchedules(int);
     void setNThreads(int);
+    void setNReplicas(int);
+    void setNProcesses(unsigned);
+    void setProcessIndex(unsigned);
     void setProcessName(std::string const&);
     void setTriggerPSet(fhicl::ParameterSet const&);
     void setTriggerPathNames(std::vector<std::string> const&);
 
     int nschedules_{1};
     int nthreads_{1};
+    int nreplicas_{0};
+    unsigned nprocesses_{1};
+    unsigned processIndex_{0};
     std::string processName_;
 
     // Parameter set of trigger paths, the key is "trigger_paths",
@@ -0,0 +1,257 @@
+#ifndef art_Utilities_PaddedPerScheduleContainer_h
+#define art_Utilities_PaddedPerScheduleContainer_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// PaddedPerScheduleContainer<T> provides the same interface as
+// PerScheduleContainer<T> except that each schedule's entry is padded
+// to a full cache line.  It should be used for per-schedule data that
+// is written on every event (e.g. counters, or small structs updated
+// during event processing), so that schedules running on different
+// threads do not invalidate each other's cache lines.
+//
+// Because the storage is allocated once, T need not be movable (e.g.
+// std::atomic<T> may be used); the size can only be set while the
+// container is invalid.  The container itself is copyable whenever T
+// is copy-assignable.
+// ======================================================================
+
+#include "art/Utilities/CacheLinePadded.h"
+#include "art/Utilities/Globals.h"
+#include "art/Utilities/ScheduleID.h"
+#include "canvas/Utilities/Exception.h"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace art {
+
+  template <typename T>
+  class PaddedPerScheduleContainer {
+
+    static_assert(ScheduleID::first().id() == 0);
+
+    using element_type = CacheLinePadded<T>;
+
+    template <typename Element>
+    class iterator_base {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+      using pointer =
+        std::conditional_t<std::is_const_v<Element>, T const*, T*>;
+      using reference =
+        std::conditional_t<std::is_const_v<Element>, T const&, T&>;
+
+      iterator_base() = default;
+      explicit iterator_base(Element* e) noexcept : e_{e} {}
+
+      reference
+      operator*() const noexcept
+      {
+        return e_->value;
+      }
+
+      pointer
+      operator->() const noexcept
+      {
+        return &e_->value;
+      }
+
+      iterator_base&
+      operator++() noexcept
+      {
+        ++e_;
+        return *this;
+      }
+
+      iterator_base
+      operator++(int) noexcept
+      {
+        auto tmp = *this;
+        ++e_;
+        return tmp;
+      }
+
+      bool
+      operator==(iterator_base const& other) const noexcept
+      {
+        return e_ == other.e_;
+      }
+
+      bool
+      operator!=(iterator_base const& other) const noexcept
+      {
+        return e_ != other.e_;
+      }
+
+    private:
+      Element* e_{nullptr};
+    };
+
+  public:
+    using iterator = iterator_base<element_type>;
+    using const_iterator = iterator_base<element_type const>;
+
+    PaddedPerScheduleContainer() = default;
+    explicit PaddedPerScheduleContainer(ScheduleID::size_type const n)
+      : size_{n}, data_{std::make_unique<element_type[]>(n)}
+    {}
+
+    // Copying is supported only if T is copy-assignable.
+    PaddedPerScheduleContainer(PaddedPerScheduleContainer const& other)
+      : size_{other.size_}, data_{std::make_unique<element_type[]>(size_)}
+    {
+      for (ScheduleID::size_type i = 0; i != size_; ++i) {
+        data_[i].value = other.data_[i].value;
+      }
+    }
+
+    PaddedPerScheduleContainer&
+    operator=(PaddedPerScheduleContainer const& other)
+    {
+      PaddedPerScheduleContainer tmp{other};
+      std::swap(size_, tmp.size_);
+      std::swap(data_, tmp.data_);
+      return *this;
+    }
+
+    PaddedPerScheduleContainer(PaddedPerScheduleContainer&& other) noexcept
+      : size_{std::exchange(other.size_, 0)}, data_{std::move(other.data_)}
+    {}
+
+    PaddedPerScheduleContainer&
+    operator=(PaddedPerScheduleContainer&& other) noexcept
+    {
+      size_ = std::exchange(other.size_, 0);
+      data_ = std::move(other.data_);
+      return *this;
+    }
+
+    bool
+    is_valid() const
+    {
+      return size_ != 0;
+    }
+
+    auto
+    size() const
+    {
+      return size_;
+    }
+
+    const_iterator
+    cbegin() const noexcept
+    {
+      return const_iterator{data_.get()};
+    }
+
+    const_iterator
+    begin() const noexcept
+    {
+      return cbegin();
+    }
+
+    iterator
+    begin() noexcept
+    {
+      return iterator{data_.get()};
+    }
+
+    const_iterator
+    cend() const noexcept
+    {
+      return const_iterator{data_.get() + size_};
+    }
+
+    const_iterator
+    end() const noexcept
+    {
+      return cend();
+    }
+
+    iterator
+    end() noexcept
+    {
+      return iterator{data_.get() + size_};
+    }
+
+    void
+    resize(ScheduleID::size_type const sz)
+    {
+      if (is_valid()) {
+        throw Exception{errors::LogicError,
+                        "An error occurred while calling "
+                        "PaddedPerScheduleContainer::resize"}
+          << "Can only call resize when the container is invalid.\n";
+      }
+      data_ = std::make_unique<element_type[]>(sz);
+      size_ = sz;
+    }
+
+    auto
+    expand_to_num_schedules()
+    {
+      if (is_valid()) {
+        throw Exception{errors::LogicError,
+                        "An error occurred while calling "
+                        "PaddedPerScheduleContainer::expand_to_num_schedules"}
+          << "Can only call expand_to_num_schedules when the "
+             "container is invalid.";
+      }
+      auto const n = Globals::instance()->nschedules();
+      resize(n);
+      return n;
+    }
+
+    T&
+    operator[](ScheduleID const sid)
+    {
+      return data_[sid.id()].value;
+    }
+
+    T const&
+    operator[](ScheduleID const sid) const
+    {
+      return data_[sid.id()].value;
+    }
+
+    T&
+    at(ScheduleID const sid)
+    {
+      range_check_(sid);
+      return data_[sid.id()].value;
+    }
+
+    T const&
+    at(ScheduleID const sid) const
+    {
+      range_check_(sid);
+      return data_[sid.id()].value;
+    }
+
+  private:
+    void
+    range_check_(ScheduleID const sid) const
+    {
+      if (sid.id() >= size_) {
+        throw std::out_of_range{"PaddedPerScheduleContainer::at"};
+      }
+    }
+
+    ScheduleID::size_type size_{};
+    std::unique_ptr<element_type[]> data_{};
+  };
+
+} // namespace art
+
+#endif /* art_Utilities_PaddedPerScheduleContainer_h */
+
+// Local Variables:
+// mode: c++
+// End:
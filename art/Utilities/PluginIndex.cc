@@ -0,0 +1,345 @@
+#include "art/Utilities/PluginIndex.h"
+// vim: set sw=2 expandtab :
+
+#include "cetlib/LibraryManager.h"
+#include "cetlib/plugin_libpath.h"
+#include "cetlib/shlib_utils.h"
+
+#include "boost/filesystem.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+extern "C" {
+#include <dirent.h>
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+using namespace std::string_literals;
+
+namespace art {
+
+  // Specification -> paths of the matching libraries.
+  class PluginIndex::Libraries {
+  public:
+    Libraries(std::string const& suffix,
+              std::vector<std::string> const& libraries);
+
+    // Empty unless the specification matches exactly one library.
+    std::string
+    pathFor(std::string const& spec) const
+    {
+      auto const it = paths_.find(spec);
+      if (it == paths_.cend() || it->second.size() != 1) {
+        return {};
+      }
+      return it->second.front();
+    }
+
+  private:
+    std::unordered_map<std::string, std::vector<std::string>> paths_{};
+  };
+
+} // namespace art
+
+namespace {
+
+  struct Directory {
+    std::string path;
+    long sec;
+    long nsec;
+  };
+
+  bool
+  operator==(Directory const& a, Directory const& b)
+  {
+    return a.path == b.path && a.sec == b.sec && a.nsec == b.nsec;
+  }
+
+  std::string const cache_header{"art_plugin_index 1"};
+
+  std::mutex mutex;
+  bool use_cache{true};
+  bool rebuild_cache{false};
+  std::map<std::string, std::shared_ptr<art::PluginIndex::Libraries const>>
+    loaded;
+
+  // The part of a library's file name between the "lib" prefix and the
+  // "_<suffix>.so" ending; empty for other files.
+  std::string
+  library_stem(std::string const& file_name, std::string const& suffix)
+  {
+    auto const& prefix = cet::shlib_prefix();
+    auto const ending = "_"s + suffix + cet::shlib_suffix();
+    if (file_name.size() <= prefix.size() + ending.size() ||
+        file_name.compare(0, prefix.size(), prefix) != 0 ||
+        file_name.compare(
+          file_name.size() - ending.size(), ending.size(), ending) != 0) {
+      return {};
+    }
+    return file_name.substr(prefix.size(),
+                            file_name.size() - prefix.size() - ending.size());
+  }
+
+  std::vector<Directory>
+  search_directories()
+  {
+    std::vector<Directory> result;
+    std::istringstream is{cet::plugin_libpath()};
+    for (std::string dir; std::getline(is, dir, ':');) {
+      if (dir.empty()) {
+        continue;
+      }
+      struct stat sb;
+      if (stat(dir.c_str(), &sb) != 0 || !S_ISDIR(sb.st_mode)) {
+        result.push_back({dir, -1, -1});
+        continue;
+      }
+      result.push_back({dir, sb.st_mtim.tv_sec, sb.st_mtim.tv_nsec});
+    }
+    return result;
+  }
+
+  // The same library name in a later directory is shadowed by the
+  // first one, as for the dynamic linker.
+  std::vector<std::string>
+  scan(std::vector<Directory> const& dirs, std::string const& suffix)
+  {
+    std::vector<std::string> result;
+    std::unordered_set<std::string> seen;
+    for (auto const& dir : dirs) {
+      auto* d = opendir(dir.path.c_str());
+      if (d == nullptr) {
+        continue;
+      }
+      std::vector<std::string> names;
+      while (auto const* entry = readdir(d)) {
+        std::string name{entry->d_name};
+        if (!library_stem(name, suffix).empty()) {
+          names.push_back(std::move(name));
+        }
+      }
+      closedir(d);
+      std::sort(names.begin(), names.end());
+      for (auto& name : names) {
+        if (seen.insert(name).second) {
+          result.push_back(dir.path + '/' + name);
+        }
+      }
+    }
+    return result;
+  }
+
+  std::string
+  cache_dir()
+  {
+    if (auto const* dir = std::getenv("ART_PLUGIN_CACHE_DIR")) {
+      return dir;
+    }
+    if (auto const* dir = std::getenv("XDG_CACHE_HOME"); dir && *dir) {
+      return dir + "/art"s;
+    }
+    if (auto const* dir = std::getenv("HOME"); dir && *dir) {
+      return dir + "/.cache/art"s;
+    }
+    return {};
+  }
+
+  // One cache file per kind of plugin and search path.
+  std::string
+  cache_file(std::string const& suffix)
+  {
+    auto const dir = cache_dir();
+    if (dir.empty()) {
+      return {};
+    }
+    std::uint64_t hash{14695981039346656037ull}; // FNV-1a
+    for (unsigned char const c : cet::plugin_libpath()) {
+      hash = (hash ^ c) * 1099511628211ull;
+    }
+    std::ostringstream os;
+    os << dir << "/plugins_" << suffix << '_' << std::hex << std::setw(16)
+       << std::setfill('0') << hash;
+    return os.str();
+  }
+
+  bool
+  read_cache(std::string const& file,
+             std::vector<Directory> const& dirs,
+             std::vector<std::string>& libraries)
+  {
+    std::ifstream is{file};
+    std::string line;
+    if (!std::getline(is, line) || line != cache_header) {
+      return false;
+    }
+    std::vector<Directory> cached_dirs;
+    while (std::getline(is, line)) {
+      if (line.size() < 2 || line[1] != ' ') {
+        return false;
+      }
+      std::istringstream ls{line.substr(2)};
+      if (line[0] == 'D') {
+        Directory dir;
+        ls >> dir.sec >> dir.nsec;
+        ls.get();
+        std::getline(ls, dir.path);
+        cached_dirs.push_back(std::move(dir));
+      } else if (line[0] == 'L') {
+        libraries.push_back(line.substr(2));
+      } else {
+        return false;
+      }
+    }
+    if (cached_dirs != dirs) {
+      libraries.clear();
+      return false;
+    }
+    return true;
+  }
+
+  void
+  write_cache(std::string const& file,
+              std::vector<Directory> const& dirs,
+              std::vector<std::string> const& libraries)
+  {
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(
+      boost::filesystem::path{file}.parent_path(), ec);
+    if (ec) {
+      return;
+    }
+    // Written aside and renamed, so that concurrent jobs never see a
+    // partial file.
+    auto const tmp = file + '.' + std::to_string(getpid());
+    {
+      std::ofstream os{tmp};
+      os << cache_header << '\n';
+      for (auto const& dir : dirs) {
+        os << "D " << dir.sec << ' ' << dir.nsec << ' ' << dir.path << '\n';
+      }
+      for (auto const& library : libraries) {
+        os << "L " << library << '\n';
+      }
+      if (!os) {
+        std::remove(tmp.c_str());
+        return;
+      }
+    }
+    if (std::rename(tmp.c_str(), file.c_str()) != 0) {
+      std::remove(tmp.c_str());
+    }
+  }
+
+  std::shared_ptr<art::PluginIndex::Libraries const>
+  load(std::string const& suffix)
+  {
+    std::lock_guard lock{mutex};
+    if (auto const it = loaded.find(suffix); it != loaded.cend()) {
+      return it->second;
+    }
+    auto const dirs = search_directories();
+    auto const file = use_cache ? cache_file(suffix) : std::string{};
+    std::vector<std::string> libraries;
+    if (file.empty() || rebuild_cache || !read_cache(file, dirs, libraries)) {
+      libraries = scan(dirs, suffix);
+      if (!file.empty()) {
+        write_cache(file, dirs, libraries);
+      }
+    }
+    auto result = std::make_shared<art::PluginIndex::Libraries const>(
+      suffix, libraries);
+    loaded.emplace(suffix, result);
+    return result;
+  }
+
+} // namespace
+
+namespace art {
+
+  // The specifications of a library are those understood by
+  // cet::LibraryManager: for libart_Framework_Modules_EmptyEvent_source.so,
+  // "EmptyEvent" and "art/Framework/Modules/EmptyEvent".
+  PluginIndex::Libraries::Libraries(std::string const& suffix,
+                                    std::vector<std::string> const& libraries)
+  {
+    for (auto const& path : libraries) {
+      auto const stem =
+        library_stem(path.substr(path.find_last_of('/') + 1), suffix);
+      std::string long_spec;
+      for (auto const c : stem) {
+        if (c != '_') {
+          long_spec += c;
+        } else if (long_spec.empty() || long_spec.back() != '/') {
+          long_spec += '/';
+        }
+      }
+      auto const short_spec =
+        long_spec.substr(long_spec.find_last_of('/') + 1);
+      if (short_spec.empty()) {
+        continue;
+      }
+      paths_[short_spec].push_back(path);
+      if (long_spec != short_spec) {
+        paths_[long_spec].push_back(path);
+      }
+    }
+  }
+
+  PluginIndex::PluginIndex(std::string suffix)
+    : suffix_{std::move(suffix)}, libraries_{load(suffix_)}
+  {}
+
+  PluginIndex::~PluginIndex() = default;
+
+  void
+  PluginIndex::setUseCache(bool const use)
+  {
+    std::lock_guard lock{mutex};
+    use_cache = use;
+  }
+
+  void
+  PluginIndex::rebuildCache()
+  {
+    std::lock_guard lock{mutex};
+    rebuild_cache = true;
+    loaded.clear();
+  }
+
+  void*
+  PluginIndex::getSymbol_(std::string const& libspec,
+                          std::string const& sym_name) const
+  {
+    if (auto const path = libraries_->pathFor(libspec); !path.empty()) {
+      if (auto* handle = dlopen(path.c_str(), RTLD_LAZY | RTLD_GLOBAL)) {
+        return dlsym(handle, sym_name.c_str());
+      }
+    }
+    void* result{nullptr};
+    libraryManager_().getSymbolByLibspec(libspec, sym_name, result);
+    return result;
+  }
+
+  cet::LibraryManager const&
+  PluginIndex::libraryManager_() const
+  {
+    std::call_once(lmCreated_, [this] {
+      lm_ = std::make_unique<cet::LibraryManager>(suffix_);
+    });
+    return *lm_;
+  }
+
+} // namespace art
@@ -0,0 +1,98 @@
+#ifndef art_Utilities_PluginIndex_h
+#define art_Utilities_PluginIndex_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// PluginIndex
+//
+// Resolves plugin specifications (e.g. "EmptyEvent" or
+// "art/Framework/Modules/EmptyEvent") of one kind--module, service,
+// source, tool...--to symbols, as cet::LibraryManager does, but
+// without scanning every directory of the plugin search path for each
+// lookup.
+//
+// The plugin libraries found on the search path are listed in an
+// on-disk cache, together with the modification times of the
+// search-path directories.  The cache is used only if none of those
+// directories has changed since it was written; otherwise the
+// directories are scanned and the cache is rewritten.  Either way, the
+// index is built at most once per kind of plugin and process, after
+// which a lookup is a direct dlopen of the library.
+//
+// Specifications that are not in the index, or that match more than
+// one library, are handed to cet::LibraryManager so that the
+// diagnostics are unchanged.
+//
+// The cache files are kept in $ART_PLUGIN_CACHE_DIR if it is set, and
+// in $XDG_CACHE_HOME/art (default $HOME/.cache/art) otherwise.  A
+// cache that cannot be written is silently ignored.
+// ======================================================================
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace cet {
+  class LibraryManager;
+}
+
+namespace art {
+
+  class PluginIndex {
+  public:
+    explicit PluginIndex(std::string suffix);
+    ~PluginIndex();
+
+    PluginIndex(PluginIndex const&) = delete;
+    PluginIndex& operator=(PluginIndex const&) = delete;
+
+    // Returns nullptr if the library does not provide the symbol.
+    template <typename T>
+    void getSymbolByLibspec(std::string const& libspec,
+                            std::string const& sym_name,
+                            T& sym) const;
+    template <typename T>
+    T getSymbolByLibspec(std::string const& libspec,
+                         std::string const& sym_name) const;
+
+    // Job-wide settings, to be applied before any plugin is loaded.
+    static void setUseCache(bool use);
+    static void rebuildCache();
+
+    class Libraries;
+
+  private:
+    void* getSymbol_(std::string const& libspec,
+                     std::string const& sym_name) const;
+    cet::LibraryManager const& libraryManager_() const;
+
+    std::string const suffix_;
+    std::shared_ptr<Libraries const> const libraries_;
+    mutable std::once_flag lmCreated_{};
+    mutable std::unique_ptr<cet::LibraryManager> lm_{nullptr};
+  };
+
+  template <typename T>
+  void
+  PluginIndex::getSymbolByLibspec(std::string const& libspec,
+                                  std::string const& sym_name,
+                                  T& sym) const
+  {
+    sym = reinterpret_cast<T>(getSymbol_(libspec, sym_name));
+  }
+
+  template <typename T>
+  T
+  PluginIndex::getSymbolByLibspec(std::string const& libspec,
+                                  std::string const& sym_name) const
+  {
+    return reinterpret_cast<T>(getSymbol_(libspec, sym_name));
+  }
+
+} // namespace art
+
+#endif /* art_Utilities_PluginIndex_h */
+
+// Local Variables:
+// mode: c++
+// End:
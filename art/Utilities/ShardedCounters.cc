@@ -0,0 +1,64 @@
+#include "art/Utilities/ShardedCounters.h"
+// vim: set sw=2 expandtab :
+
+#include "canvas/Utilities/Exception.h"
+#include "tbb/global_control.h"
+#include "tbb/task_arena.h"
+
+#include <algorithm>
+
+namespace {
+  std::size_t
+  default_nshards()
+  {
+    return std::max<std::size_t>(
+      1,
+      tbb::global_control::active_value(
+        tbb::global_control::max_allowed_parallelism));
+  }
+}
+
+namespace art {
+
+  ShardedCounters::ShardedCounters(std::size_t const ncounters)
+    : ShardedCounters{ncounters, default_nshards()}
+  {}
+
+  ShardedCounters::ShardedCounters(std::size_t const ncounters,
+                                   std::size_t const nshards)
+    : ncounters_{ncounters}
+    , nshards_{std::max<std::size_t>(1, nshards)}
+    , shards_{std::make_unique<Shard[]>(nshards_)}
+  {
+    if (ncounters_ > max_counters) {
+      throw Exception{errors::LogicError,
+                      "An error occurred while constructing ShardedCounters"}
+        << "At most " << max_counters
+        << " counters can share a shard, but " << ncounters_
+        << " were requested.\n";
+    }
+  }
+
+  void
+  ShardedCounters::reset() noexcept
+  {
+    for (std::size_t i = 0; i != nshards_; ++i) {
+      for (auto& slot : shards_[i].slots) {
+        slot.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  std::size_t
+  ShardedCounters::shard_index_() const noexcept
+  {
+    // Threads that have not joined a task arena (e.g. the main thread
+    // before any task has been spawned) share the first shard.
+    auto const index = tbb::this_task_arena::current_thread_index();
+    if (index < 0) {
+      return 0;
+    }
+    return static_cast<std::size_t>(index) % nshards_;
+  }
+
+} // namespace art
@@ -0,0 +1,142 @@
+#ifndef art_Utilities_ShardedCounters_h
+#define art_Utilities_ShardedCounters_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// ShardedCounters holds a small, fixed number of counters that may be
+// incremented concurrently from many threads without the increments
+// contending for the same cache line.
+//
+// Each TBB thread increments its own cache-line-sized shard, which
+// holds one slot for each of the counters; the shards are summed only
+// when a counter is read.  Reading is therefore comparatively
+// expensive and should be reserved for reporting (e.g. the end-of-job
+// summary).  Since all counters of one object share each shard, the
+// memory cost is one cache line per thread, independent of the number
+// of counters.  A single shard is simply a cache-line-padded array of
+// atomic counters.
+//
+// Individual counters are accessed through lightweight Counter
+// handles, which support the increment/load operations of
+// std::atomic<std::size_t> that the framework relies on:
+//
+//   ShardedCounters counts{3};
+//   auto visited = counts[0];
+//   ++visited;
+//   std::size_t const n = visited.load();
+// ======================================================================
+
+#include "art/Utilities/CacheLinePadded.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace art {
+
+  class ShardedCounters {
+    using slot_t = std::atomic<std::size_t>;
+
+  public:
+    static constexpr std::size_t max_counters{detail::cache_line_size /
+                                              sizeof(slot_t)};
+
+  private:
+    struct alignas(detail::cache_line_size) Shard {
+      slot_t slots[max_counters]{};
+    };
+
+  public:
+    class Counter {
+    public:
+      Counter(ShardedCounters& counters, std::size_t const index) noexcept
+        : counters_{&counters}, index_{index}
+      {}
+
+      Counter&
+      operator++() noexcept
+      {
+        counters_->add(index_, 1);
+        return *this;
+      }
+
+      Counter&
+      operator+=(std::size_t const n) noexcept
+      {
+        counters_->add(index_, n);
+        return *this;
+      }
+
+      std::size_t
+      load() const noexcept
+      {
+        return counters_->load(index_);
+      }
+
+    private:
+      ShardedCounters* counters_;
+      std::size_t index_;
+    };
+
+    // The default number of shards is the maximum number of threads
+    // TBB is allowed to use.
+    explicit ShardedCounters(std::size_t ncounters);
+    ShardedCounters(std::size_t ncounters, std::size_t nshards);
+
+    ShardedCounters(ShardedCounters const&) = delete;
+    ShardedCounters& operator=(ShardedCounters const&) = delete;
+
+    Counter
+    operator[](std::size_t const index) noexcept
+    {
+      return Counter{*this, index};
+    }
+
+    std::size_t
+    ncounters() const noexcept
+    {
+      return ncounters_;
+    }
+
+    std::size_t
+    nshards() const noexcept
+    {
+      return nshards_;
+    }
+
+    // With a single shard (e.g. counters owned by one schedule), the
+    // thread's shard need not be looked up.
+    void
+    add(std::size_t const index, std::size_t const n) noexcept
+    {
+      auto const shard = nshards_ == 1 ? 0 : shard_index_();
+      shards_[shard].slots[index].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    std::size_t
+    load(std::size_t const index) const noexcept
+    {
+      std::size_t result{};
+      for (std::size_t i = 0; i != nshards_; ++i) {
+        result += shards_[i].slots[index].load(std::memory_order_relaxed);
+      }
+      return result;
+    }
+
+    void reset() noexcept;
+
+  private:
+    std::size_t shard_index_() const noexcept;
+
+    std::size_t const ncounters_;
+    std::size_t const nshards_;
+    std::unique_ptr<Shard[]> shards_;
+  };
+
+} // namespace art
+
+#endif /* art_Utilities_ShardedCounters_h */
+
+// Local Variables:
+// mode: c++
+// End:
@@ -1,8 +1,8 @@
 #ifndef art_Utilities_detail_tool_type_h
 #define art_Utilities_detail_tool_type_h
 
+#include "art/Utilities/PluginIndex.h"
 #include "canvas/Utilities/Exception.h"
-#include "cetlib/BasicPluginFactory.h"
 
 #include <functional>
 #include <memory>
@@ -15,6 +15,21 @@ namespace fhicl {
 
 namespace art::detail {
 
+  template <typename T>
+  T
+  tool_symbol(PluginIndex const& index,
+              std::string const& libspec,
+              std::string const& sym_name)
+  {
+    auto const result = index.getSymbolByLibspec<T>(libspec, sym_name);
+    if (result == nullptr) {
+      throw Exception(errors::Configuration, "BadPluginLibrary: ")
+        << "Tool " << libspec << " does not define the symbol \"" << sym_name
+        << "\".\n";
+    }
+    return result;
+  }
+
   template <typename T, typename = void>
   struct tool_type;
 
@@ -23,11 +38,12 @@ namespace art::detail {
     using return_type = std::unique_ptr<T>;
 
     static auto
-    make_plugin(cet::BasicPluginFactory& factory,
+    make_plugin(PluginIndex const& index,
                 std::string const& libspec,
                 fhicl::ParameterSet const& pset)
     {
-      return factory.makePlugin<std::unique_ptr<T>>(libspec, pset);
+      using make_t = std::unique_ptr<T>(fhicl::ParameterSet const&);
+      return tool_symbol<make_t*>(index, libspec, "makeTool")(pset);
     }
   };
 
@@ -36,14 +52,17 @@ namespace art::detail {
     using return_type = std::function<T>;
 
     static auto
-    make_plugin(cet::BasicPluginFactory& factory,
+    make_plugin(PluginIndex const& index,
                 std::string const& libspec,
                 fhicl::ParameterSet const&,
                 std::string const& function_plugin_type)
     {
-      auto const pluginType = factory.pluginType(libspec);
+      using type_t = std::string();
+      auto const pluginType =
+        tool_symbol<type_t*>(index, libspec, "toolType")();
+      // The library defines a variable holding the function pointer.
       return pluginType == function_plugin_type ?
-               factory.makePlugin<T>(libspec) :
+               return_type{*tool_symbol<T**>(index, libspec, "toolFunction")} :
                throw Exception(errors::Configuration,
                                "tool_type::make_plugin: ")
                  << "Unrecognized function-tool type \"" << function_plugin_type
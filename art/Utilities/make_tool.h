@@ -1,10 +1,10 @@
 #ifndef art_Utilities_make_tool_h
 #define art_Utilities_make_tool_h
 
+#include "art/Utilities/PluginIndex.h"
 #include "art/Utilities/PluginSuffixes.h"
 #include "art/Utilities/detail/tool_type.h"
 #include "canvas/Utilities/Exception.h"
-#include "cetlib/BasicPluginFactory.h"
 #include "cetlib/detail/wrapLibraryManagerException.h"
 #include "fhiclcpp/ParameterSet.h"
 
@@ -17,11 +17,11 @@ namespace art {
   std::enable_if_t<std::is_class<T>::value, tool_return_type<T>>
   make_tool(fhicl::ParameterSet const& pset)
   {
-    cet::BasicPluginFactory factory{Suffixes::tool(), "makeTool"};
+    PluginIndex const index{Suffixes::tool()};
     std::string const libspec{pset.get<std::string>("tool_type")};
     tool_return_type<T> result;
     try {
-      result = detail::tool_type<T>::make_plugin(factory, libspec, pset);
+      result = detail::tool_type<T>::make_plugin(index, libspec, pset);
     }
     catch (cet::exception const& e) {
       throw Exception(errors::Configuration, "make_tool: ", e)
@@ -35,13 +35,12 @@ namespace art {
   make_tool(fhicl::ParameterSet const& pset,
             std::string const& function_tool_type)
   {
-    cet::BasicPluginFactory factory{
-      Suffixes::tool(), "toolFunction", "toolType"};
+    PluginIndex const index{Suffixes::tool()};
     std::string const libspec{pset.get<std::string>("tool_type")};
     tool_return_type<T> result;
     try {
       result = detail::tool_type<T>::make_plugin(
-        factory, libspec, pset, function_tool_type);
+        index, libspec, pset, function_tool_type);
     }
     catch (cet::exception const& e) {
       throw Exception(errors::Configuration, "make_tool: ", e)
@@ -0,0 +1,45 @@
+#include "art/test/Benchmarks/AllocationCounter.h"
+#include "art/Utilities/CacheLinePadded.h"
+
+#include <atomic>
+
+namespace {
+  // Allocations are counted in one of several cache lines, chosen per
+  // thread, to avoid the allocating threads contending for a single
+  // counter.  The storage is static and constant-initialized so that
+  // counting does not itself allocate.
+  constexpr std::size_t nslots{64};
+  art::CacheLinePadded<std::atomic<std::size_t>> slots[nslots];
+  std::atomic<std::size_t> next_slot{};
+  std::atomic<bool> enabled{false};
+}
+
+void
+art::test::benchmark::count_allocation() noexcept
+{
+  thread_local std::size_t const slot{
+    next_slot.fetch_add(1, std::memory_order_relaxed) % nslots};
+  slots[slot].value.fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+art::test::benchmark::enable_allocation_counting() noexcept
+{
+  enabled = true;
+}
+
+bool
+art::test::benchmark::allocation_counting_enabled() noexcept
+{
+  return enabled;
+}
+
+std::size_t
+art::test::benchmark::allocations() noexcept
+{
+  std::size_t result{};
+  for (auto const& slot : slots) {
+    result += slot.value.load(std::memory_order_relaxed);
+  }
+  return result;
+}
@@ -0,0 +1,28 @@
+#ifndef art_test_Benchmarks_AllocationCounter_h
+#define art_test_Benchmarks_AllocationCounter_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// Counts the number of calls to the global allocation functions.
+//
+// The counting itself is done by the replacement operator new
+// provided by the art_bench executable, which calls
+// count_allocation() and enables counting before the job starts.
+// When a job is run with any other executable, counting is disabled
+// and allocations() always returns zero.
+// ======================================================================
+
+#include <cstddef>
+
+namespace art::test::benchmark {
+  void count_allocation() noexcept;
+  void enable_allocation_counting() noexcept;
+  bool allocation_counting_enabled() noexcept;
+  std::size_t allocations() noexcept;
+}
+
+#endif /* art_test_Benchmarks_AllocationCounter_h */
+
+// Local Variables:
+// mode: c++
+// End:
@@ -0,0 +1,79 @@
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// BenchAnalyzer: a synthetic analyzer for the framework-overhead
+// benchmarks.
+//
+// It reads the products listed in 'inputs' or, if 'readAll' is true,
+// every std::vector<int> product in the event, and then spins for
+// 'workNs' nanoseconds.
+// ======================================================================
+
+#include "art/Framework/Core/SharedAnalyzer.h"
+#include "art/Framework/Principal/Event.h"
+#include "art/Framework/Principal/Handle.h"
+#include "art/test/Utilities/busy_wait.h"
+#include "canvas/Utilities/InputTag.h"
+#include "fhiclcpp/types/Atom.h"
+#include "fhiclcpp/types/Sequence.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace art::test {
+
+  class BenchAnalyzer : public SharedAnalyzer {
+  public:
+    struct Config {
+      fhicl::Atom<bool> readAll{fhicl::Name{"readAll"}, false};
+      fhicl::Atom<unsigned> workNs{fhicl::Name{"workNs"}, 0u};
+      fhicl::Sequence<std::string> inputs{
+        fhicl::Name{"inputs"},
+        fhicl::Comment{"Input tags of the std::vector<int> products to read."},
+        std::vector<std::string>{}};
+    };
+    using Parameters = Table<Config>;
+    explicit BenchAnalyzer(Parameters const& p, ProcessingFrame const&);
+
+  private:
+    void analyze(Event const& e, ProcessingFrame const&) override;
+
+    std::vector<ProductToken<std::vector<int>>> inputs_{};
+    bool const readAll_;
+    std::chrono::nanoseconds const work_;
+    std::atomic<std::size_t> nElements_{};
+  };
+
+  BenchAnalyzer::BenchAnalyzer(Parameters const& p, ProcessingFrame const&)
+    : SharedAnalyzer{p}, readAll_{p().readAll()}, work_{p().workNs()}
+  {
+    for (auto const& tag : p().inputs()) {
+      inputs_.push_back(consumes<std::vector<int>>(InputTag{tag}));
+    }
+    if (readAll_) {
+      consumesMany<std::vector<int>>();
+    }
+    async<InEvent>();
+  }
+
+  void
+  BenchAnalyzer::analyze(Event const& e, ProcessingFrame const&)
+  {
+    std::size_t n{};
+    for (auto const& token : inputs_) {
+      n += e.getProduct(token).size();
+    }
+    if (readAll_) {
+      for (auto const& h : e.getMany<std::vector<int>>()) {
+        n += h->size();
+      }
+    }
+    busy_wait(work_);
+    nElements_ += n;
+  }
+
+} // namespace art::test
+
+DEFINE_ART_MODULE(art::test::BenchAnalyzer)
@@ -0,0 +1,69 @@
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// BenchFilter: a synthetic filter for the framework-overhead
+// benchmarks.
+//
+// It reads the products listed in 'inputs', spins for 'workNs'
+// nanoseconds, and accepts 'acceptPercent' percent of the events,
+// chosen by event number.
+// ======================================================================
+
+#include "art/Framework/Core/SharedFilter.h"
+#include "art/Framework/Principal/Event.h"
+#include "art/test/Utilities/busy_wait.h"
+#include "canvas/Utilities/InputTag.h"
+#include "fhiclcpp/types/Atom.h"
+#include "fhiclcpp/types/Sequence.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace art::test {
+
+  class BenchFilter : public SharedFilter {
+  public:
+    struct Config {
+      fhicl::Atom<unsigned> acceptPercent{fhicl::Name{"acceptPercent"}, 100u};
+      fhicl::Atom<unsigned> workNs{fhicl::Name{"workNs"}, 0u};
+      fhicl::Sequence<std::string> inputs{
+        fhicl::Name{"inputs"},
+        fhicl::Comment{"Input tags of the std::vector<int> products to read."},
+        std::vector<std::string>{}};
+    };
+    using Parameters = Table<Config>;
+    explicit BenchFilter(Parameters const& p, ProcessingFrame const&);
+
+  private:
+    bool filter(Event& e, ProcessingFrame const&) override;
+
+    std::vector<ProductToken<std::vector<int>>> inputs_{};
+    unsigned const acceptPercent_;
+    std::chrono::nanoseconds const work_;
+  };
+
+  BenchFilter::BenchFilter(Parameters const& p, ProcessingFrame const&)
+    : SharedFilter{p}
+    , acceptPercent_{p().acceptPercent()}
+    , work_{p().workNs()}
+  {
+    for (auto const& tag : p().inputs()) {
+      inputs_.push_back(consumes<std::vector<int>>(InputTag{tag}));
+    }
+    async<InEvent>();
+  }
+
+  bool
+  BenchFilter::filter(Event& e, ProcessingFrame const&)
+  {
+    for (auto const& token : inputs_) {
+      (void)e.getProduct(token);
+    }
+    busy_wait(work_);
+    return e.event() % 100 < acceptPercent_;
+  }
+
+} // namespace art::test
+
+DEFINE_ART_MODULE(art::test::BenchFilter)
@@ -0,0 +1,41 @@
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// BenchNullOutput: an output module that writes nothing, so that the
+// framework-overhead benchmarks include the cost of product selection
+// and output bookkeeping without that of any I/O.
+// ======================================================================
+
+#include "art/Framework/Core/OutputModule.h"
+#include "art/Framework/Principal/fwd.h"
+#include "fhiclcpp/types/ConfigurationTable.h"
+
+namespace art::test {
+
+  class BenchNullOutput : public OutputModule {
+  public:
+    struct Config {
+      fhicl::TableFragment<OutputModule::Config> omConfig;
+    };
+
+    using Parameters =
+      fhicl::WrappedTable<Config, OutputModule::Config::KeysToIgnore>;
+    explicit BenchNullOutput(Parameters const& p)
+      : OutputModule{p().omConfig}
+    {}
+
+  private:
+    void
+    write(EventPrincipal&) override
+    {}
+    void
+    writeRun(RunPrincipal&) override
+    {}
+    void
+    writeSubRun(SubRunPrincipal&) override
+    {}
+  };
+
+} // namespace art::test
+
+DEFINE_ART_MODULE(art::test::BenchNullOutput)
@@ -0,0 +1,83 @@
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// BenchProducer: a synthetic producer for the framework-overhead
+// benchmarks.
+//
+// For each event, it reads the products listed in 'inputs' (thereby
+// creating data dependencies on the modules that make them), spins for
+// 'workNs' nanoseconds, and puts 'nProducts' products of type
+// std::vector<int>, each with 'productSize' elements.  The products
+// have the instance names "p0", "p1", ...
+// ======================================================================
+
+#include "art/Framework/Core/SharedProducer.h"
+#include "art/Framework/Principal/Event.h"
+#include "art/test/Utilities/busy_wait.h"
+#include "canvas/Utilities/InputTag.h"
+#include "fhiclcpp/types/Atom.h"
+#include "fhiclcpp/types/Sequence.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace art::test {
+
+  class BenchProducer : public SharedProducer {
+  public:
+    struct Config {
+      fhicl::Atom<unsigned> nProducts{fhicl::Name{"nProducts"}, 1u};
+      fhicl::Atom<unsigned> productSize{fhicl::Name{"productSize"}, 1u};
+      fhicl::Atom<unsigned> workNs{fhicl::Name{"workNs"}, 0u};
+      fhicl::Sequence<std::string> inputs{
+        fhicl::Name{"inputs"},
+        fhicl::Comment{"Input tags of the std::vector<int> products to read."},
+        std::vector<std::string>{}};
+    };
+    using Parameters = Table<Config>;
+    explicit BenchProducer(Parameters const& p, ProcessingFrame const&);
+
+  private:
+    void produce(Event& e, ProcessingFrame const&) override;
+
+    std::vector<std::string> instances_{};
+    std::vector<ProductToken<std::vector<int>>> inputs_{};
+    unsigned const productSize_;
+    std::chrono::nanoseconds const work_;
+  };
+
+  BenchProducer::BenchProducer(Parameters const& p, ProcessingFrame const&)
+    : SharedProducer{p}
+    , productSize_{p().productSize()}
+    , work_{p().workNs()}
+  {
+    for (unsigned i = 0; i != p().nProducts(); ++i) {
+      instances_.push_back("p" + std::to_string(i));
+      produces<std::vector<int>>(instances_.back());
+    }
+    for (auto const& tag : p().inputs()) {
+      inputs_.push_back(consumes<std::vector<int>>(InputTag{tag}));
+    }
+    async<InEvent>();
+  }
+
+  void
+  BenchProducer::produce(Event& e, ProcessingFrame const&)
+  {
+    int sum{};
+    for (auto const& token : inputs_) {
+      for (int const i : e.getProduct(token)) {
+        sum += i;
+      }
+    }
+    busy_wait(work_);
+    for (auto const& instance : instances_) {
+      e.put(std::make_unique<std::vector<int>>(productSize_, sum), instance);
+    }
+  }
+
+} // namespace art::test
+
+DEFINE_ART_MODULE(art::test::BenchProducer)
@@ -0,0 +1,204 @@
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// BenchmarkRecorder: measures the per-event cost of the framework for
+// the framework-overhead benchmarks.
+//
+// Once 'warmupEvents' events have been processed, the service records
+// the wall-clock time, the time spent inside modules' event functions,
+// and (when run with art_bench) the number of allocations, until the
+// end of the job.  It then appends one line of JSON describing the
+// job to the file 'fileName', so that results from many jobs (and
+// releases) can be collected for regression tracking:
+//
+//   {"workflow": ..., "nschedules": ..., "nthreads": ...,
+//    "modules": ..., "paths": ..., "events": ...,
+//    "events_per_second": ..., "framework_ns_per_event": ...,
+//    "module_ns_per_event": ..., "allocations_per_event": ...}
+//
+// The framework overhead is the time each schedule spends per event,
+// less the time spent in the modules themselves:
+//
+//   (wall time * min(nschedules, nthreads) - module time) / events
+//
+// Run and subrun transitions, and the end-of-job work done before the
+// service is notified, are included.  If allocations were not
+// counted, "allocations_per_event" is null.
+// ======================================================================
+
+#include "art/Framework/Services/Registry/ActivityRegistry.h"
+#include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
+#include "art/Framework/Services/Registry/ServiceDefinitionMacros.h"
+#include "art/Framework/Services/Registry/ServiceTable.h"
+#include "art/Persistency/Provenance/ModuleContext.h"
+#include "art/Persistency/Provenance/ModuleDescription.h"
+#include "art/Persistency/Provenance/ScheduleContext.h"
+#include "art/Utilities/Globals.h"
+#include "art/Utilities/ShardedCounters.h"
+#include "art/test/Benchmarks/AllocationCounter.h"
+#include "fhiclcpp/types/Atom.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+
+using namespace std::chrono;
+
+namespace art::test {
+
+  class BenchmarkRecorder {
+  public:
+    struct Config {
+      fhicl::Atom<std::string> workflow{
+        fhicl::Name{"workflow"},
+        fhicl::Comment{"A name identifying the benchmarked configuration."}};
+      fhicl::Atom<std::string> fileName{
+        fhicl::Name{"fileName"},
+        fhicl::Comment{"The file to which the results are appended, one JSON "
+                       "object per line.\n"
+                       "If empty, the results are only logged."},
+        "benchmark_results.jsonl"};
+      fhicl::Atom<unsigned> warmupEvents{fhicl::Name{"warmupEvents"}, 0u};
+    };
+    using Parameters = ServiceTable<Config>;
+    BenchmarkRecorder(Parameters const&, ActivityRegistry&);
+
+  private:
+    void start();
+    void postModuleConstruction(ModuleDescription const&);
+    void postBeginJob();
+    void postProcessEvent(Event const&, ScheduleContext);
+    void preModule(ModuleContext const&);
+    void postModule(ModuleContext const&);
+    void postEndJob();
+
+    std::string const workflow_;
+    std::string const fileName_;
+    std::size_t const warmupEvents_;
+    std::set<std::string> moduleLabels_{};
+    std::atomic<std::size_t> events_{};
+    std::atomic<bool> measuring_{false};
+    steady_clock::time_point start_{};
+    std::size_t startAllocations_{};
+    // Counter 0 holds the nanoseconds spent in modules.
+    ShardedCounters moduleTime_{1};
+  };
+
+  namespace {
+    thread_local steady_clock::time_point moduleStart;
+  }
+
+  BenchmarkRecorder::BenchmarkRecorder(Parameters const& config,
+                                       ActivityRegistry& areg)
+    : workflow_{config().workflow()}
+    , fileName_{config().fileName()}
+    , warmupEvents_{config().warmupEvents()}
+  {
+    areg.sPostModuleConstruction.watch(
+      this, &BenchmarkRecorder::postModuleConstruction);
+    areg.sPostBeginJob.watch(this, &BenchmarkRecorder::postBeginJob);
+    areg.sPostProcessEvent.watch(this, &BenchmarkRecorder::postProcessEvent);
+    areg.sPreModule.watch(this, &BenchmarkRecorder::preModule);
+    areg.sPostModule.watch(this, &BenchmarkRecorder::postModule);
+    areg.sPostEndJob.watch(this, &BenchmarkRecorder::postEndJob);
+  }
+
+  void
+  BenchmarkRecorder::start()
+  {
+    startAllocations_ = benchmark::allocations();
+    start_ = steady_clock::now();
+    measuring_ = true;
+  }
+
+  void
+  BenchmarkRecorder::postModuleConstruction(ModuleDescription const& md)
+  {
+    // Replicated modules are constructed once per schedule.
+    moduleLabels_.insert(md.moduleLabel());
+  }
+
+  void
+  BenchmarkRecorder::postBeginJob()
+  {
+    if (warmupEvents_ == 0) {
+      start();
+    }
+  }
+
+  void
+  BenchmarkRecorder::postProcessEvent(Event const&, ScheduleContext)
+  {
+    if (++events_ == warmupEvents_ && warmupEvents_ != 0) {
+      start();
+    }
+  }
+
+  void
+  BenchmarkRecorder::preModule(ModuleContext const&)
+  {
+    moduleStart = steady_clock::now();
+  }
+
+  void
+  BenchmarkRecorder::postModule(ModuleContext const&)
+  {
+    if (!measuring_.load(std::memory_order_relaxed)) {
+      return;
+    }
+    auto const elapsed = steady_clock::now() - moduleStart;
+    moduleTime_.add(0, duration_cast<nanoseconds>(elapsed).count());
+  }
+
+  void
+  BenchmarkRecorder::postEndJob()
+  {
+    auto const stop = steady_clock::now();
+    auto const allocations = benchmark::allocations() - startAllocations_;
+    auto const events = events_.load() - std::min(events_.load(),
+                                                  warmupEvents_);
+    auto const* globals = Globals::instance();
+    auto const nschedules = globals->nschedules();
+    auto const nthreads = globals->nthreads();
+
+    std::ostringstream os;
+    os << "{\"workflow\": \"" << workflow_ << '"'
+       << ", \"nschedules\": " << nschedules << ", \"nthreads\": " << nthreads
+       << ", \"modules\": " << moduleLabels_.size()
+       << ", \"paths\": " << globals->triggerPathNames().size()
+       << ", \"events\": " << events;
+    if (measuring_ && events != 0) {
+      double const wall_ns = duration_cast<nanoseconds>(stop - start_).count();
+      double const module_ns = moduleTime_[0].load();
+      auto const concurrency = std::min(nschedules, nthreads);
+      os << ", \"events_per_second\": " << events * 1e9 / wall_ns
+         << ", \"framework_ns_per_event\": "
+         << (wall_ns * concurrency - module_ns) / events
+         << ", \"module_ns_per_event\": " << module_ns / events
+         << ", \"allocations_per_event\": ";
+      if (benchmark::allocation_counting_enabled()) {
+        os << static_cast<double>(allocations) / events;
+      } else {
+        os << "null";
+      }
+    }
+    os << '}';
+
+    mf::LogAbsolute("BenchmarkRecorder") << os.str();
+    if (fileName_.empty()) {
+      return;
+    }
+    std::ofstream results{fileName_, std::ios::app};
+    results << os.str() << '\n';
+  }
+
+} // namespace art::test
+
+DECLARE_ART_SERVICE(art::test::BenchmarkRecorder, SHARED)
+DEFINE_ART_SERVICE(art::test::BenchmarkRecorder)
@@ -0,0 +1,49 @@
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// art_bench: an art executable for the framework-overhead benchmarks.
+//
+// It behaves exactly like 'art', except that it replaces the global
+// allocation functions so that the BenchmarkRecorder service can
+// report the number of allocations per event.
+// ======================================================================
+
+#include "art/Framework/Art/artapp.h"
+#include "art/test/Benchmarks/AllocationCounter.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+#include <cstdlib>
+#include <new>
+
+// The default implementations of the array and nothrow forms of
+// operator new (delete) call these, so they are counted as well.
+void*
+operator new(std::size_t const size)
+{
+  art::test::benchmark::count_allocation();
+  if (auto* p = std::malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw std::bad_alloc{};
+}
+
+void
+operator delete(void* const p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void* const p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+int
+main(int argc, char* argv[])
+{
+  art::test::benchmark::enable_allocation_counting();
+  auto const rc = artapp(argc, argv);
+  mf::EndMessageFacility();
+  return rc;
+}
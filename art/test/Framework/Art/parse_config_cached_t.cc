@@ -0,0 +1,167 @@
+// vim: set sw=2 expandtab :
+#define BOOST_TEST_MODULE (parse_config_cached test)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Framework/Art/detail/parse_config_cached.h"
+#include "boost/filesystem.hpp"
+#include "cetlib/filepath_maker.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "fhiclcpp/intermediate_table.h"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using art::detail::parse_config_cached;
+namespace bfs = boost::filesystem;
+
+namespace {
+  bfs::path const dir{bfs::absolute("parse_config_cached_t.d")};
+  std::string const cache_dir{(dir / "cache").string()};
+
+  void
+  write(std::string const& name, std::string const& contents)
+  {
+    std::ofstream{(dir / name).string()} << contents;
+  }
+
+  fhicl::intermediate_table
+  parse(std::string const& name, bfs::path const& in = dir)
+  {
+    cet::filepath_lookup maker{in.string()};
+    return parse_config_cached(name, maker, (in / "cache").string());
+  }
+
+  // Used by the nested_tables and fresh_registry tests, which run in
+  // separate processes.
+  bfs::path const nested_dir{bfs::absolute("nested.d")};
+  std::string const nested_config{
+    "services: { scheduler: { num_threads: 3 } }\n"
+    "physics: {\n"
+    "  producers: { p: { module_type: P values: [1, 2] } }\n"
+    "  t: [p]\n"
+    "}\n"
+    "outputs: { o: { module_type: O fileName: \"out.root\" } }\n"};
+
+  void
+  check_nested(fhicl::intermediate_table const& config)
+  {
+    auto const pset = fhicl::ParameterSet::make(config);
+    BOOST_TEST(pset.get<int>("services.scheduler.num_threads") == 3);
+    BOOST_TEST(pset.get<std::string>("physics.producers.p.module_type") ==
+               "P");
+    BOOST_TEST(pset.get<std::vector<int>>("physics.producers.p.values") ==
+                 (std::vector<int>{1, 2}),
+               boost::test_tools::per_element());
+    BOOST_TEST(pset.get<std::vector<std::string>>("physics.t") ==
+                 std::vector<std::string>{"p"},
+               boost::test_tools::per_element());
+    BOOST_TEST(pset.get<std::string>("outputs.o.fileName") == "out.root");
+  }
+
+  // The single cache entry, if any.
+  bfs::path
+  cache_file()
+  {
+    if (!bfs::exists(cache_dir)) {
+      return {};
+    }
+    bfs::path result;
+    for (auto const& entry : bfs::directory_iterator{cache_dir}) {
+      BOOST_TEST(result.empty());
+      result = entry.path();
+    }
+    return result;
+  }
+
+  struct Files {
+    Files()
+    {
+      bfs::remove_all(dir);
+      bfs::create_directories(dir);
+    }
+  };
+}
+
+BOOST_FIXTURE_TEST_SUITE(parse_config_cached_t, Files)
+
+BOOST_AUTO_TEST_CASE(reuse)
+{
+  write("inc.fcl", "a: 1\n");
+  write("main.fcl", "#include \"inc.fcl\"\nb: 2\n");
+  auto config = parse("main.fcl");
+  BOOST_TEST(config.get<int>("a") == 1);
+  BOOST_TEST(config.get<int>("b") == 2);
+  auto const file = cache_file();
+  BOOST_TEST_REQUIRE(!file.empty());
+
+  // Substitute the cached document: it is what is returned as long as
+  // the configuration files are unchanged.
+  std::string contents;
+  {
+    std::ifstream is{file.string()};
+    for (std::string line; std::getline(is, line);) {
+      contents += line.rfind("C ", 0) == 0 ? "C a:5 b:2" : line + '\n';
+    }
+  }
+  std::ofstream{file.string()} << contents;
+  config = parse("main.fcl");
+  BOOST_TEST(config.get<int>("a") == 5);
+
+  // A change to an included file is seen.
+  write("inc.fcl", "a: 3\n");
+  config = parse("main.fcl");
+  BOOST_TEST(config.get<int>("a") == 3);
+  config = parse("main.fcl");
+  BOOST_TEST(config.get<int>("a") == 3);
+}
+
+BOOST_AUTO_TEST_CASE(protected_values_not_cached)
+{
+  write("main.fcl", "a @protect_ignore: 1\n");
+  auto const config = parse("main.fcl");
+  BOOST_TEST(config.get<int>("a") == 1);
+  BOOST_TEST(cache_file().empty());
+}
+
+BOOST_AUTO_TEST_CASE(nested_tables)
+{
+  bfs::remove_all(nested_dir);
+  bfs::create_directories(nested_dir);
+  std::ofstream{(nested_dir / "main.fcl").string()} << nested_config;
+  check_nested(parse("main.fcl", nested_dir));
+
+  bfs::path file;
+  for (auto const& entry : bfs::directory_iterator{nested_dir / "cache"}) {
+    file = entry.path();
+  }
+  BOOST_TEST_REQUIRE(!file.empty());
+  std::ifstream is{file.string()};
+  std::string const contents{std::istreambuf_iterator<char>{is}, {}};
+  // Nested tables must be written out in full, not as references to
+  // this process's ParameterSetRegistry.
+  BOOST_TEST(contents.find("@id::") == std::string::npos);
+
+  // Mark the cached document, so that the fresh_registry test can
+  // tell that it was used.
+  std::ofstream{file.string(), std::ios::app} << "\ncached: true\n";
+  check_nested(parse("main.fcl", nested_dir));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// Run in a separate process (see CMakeLists.txt) after the
+// nested_tables test, so that the cache is read with a registry that
+// has never seen the nested tables.
+BOOST_AUTO_TEST_CASE(fresh_registry)
+{
+  auto const& suite = boost::unit_test::framework::master_test_suite();
+  if (suite.argc < 2) {
+    return;
+  }
+  bfs::path const in{suite.argv[1]};
+  auto const config = parse("main.fcl", bfs::absolute(in));
+  BOOST_TEST(fhicl::ParameterSet::make(config).get<bool>("cached", false));
+  check_nested(config);
+}
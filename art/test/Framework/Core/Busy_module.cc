@@ -3,6 +3,7 @@
 #include "art/Framework/Core/SharedAnalyzer.h"
 #include "art/Framework/Principal/fwd.h"
 #include "art/Utilities/Globals.h"
+#include "art/test/Utilities/busy_wait.h"
 #include "fhiclcpp/types/Atom.h"
 
 #include <chrono>
@@ -39,15 +40,14 @@ namespace {
     void
     analyze(art::Event const&, art::ProcessingFrame const&) override
     {
-      auto const begin = now();
-      while (duration_cast<seconds>(now() - begin).count() < waitFor_) {
-      }
+      art::test::busy_wait(
+        duration_cast<nanoseconds>(duration<double>{waitFor_}));
     }
 
     void
     endJob(art::ProcessingFrame const&) override
     {
-      auto const time_taken = duration_cast<seconds>(now() - begin_).count();
+      auto const time_taken = duration<double>{now() - begin_}.count();
       auto const n_schedules = art::Globals::instance()->nschedules();
       auto const expected_lower_limit = (waitFor_ * nEvents_) / n_schedules;
       BOOST_TEST(time_taken >= expected_lower_limit);
@@ -109,6 +109,54 @@ testall(const Strings& paths,
   }
 }
 
+// Exercise trigger-path positions beyond the first 64 paths, which
+// are evaluated using more than one word of the packed path states.
+void
+testmany()
+{
+  constexpr unsigned npaths{100};
+  Strings paths;
+  for (unsigned i = 0; i != npaths; ++i) {
+    paths.push_back(to_string(i) + ":p" + to_string(i));
+  }
+  ParameterSet trigger_pset;
+  trigger_pset.put<Strings>("trigger_paths", paths);
+  ParameterSetRegistry::put(trigger_pset);
+
+  auto check = [&trigger_pset](Strings const& pattern,
+                               HLTGlobalStatus const& bm,
+                               bool const answer) {
+    EventSelector const selector{pattern};
+    TriggerResults const results{bm, trigger_pset.id()};
+    if (selector.acceptEvent(ScheduleID::first(), results) != answer) {
+      std::cerr << "failed to compare pattern with many paths: "
+                << "correct=" << answer << " "
+                << "pattern=" << pattern << '\n';
+      abort();
+    }
+  };
+
+  HLTGlobalStatus bm(npaths);
+  for (unsigned i = 0; i != npaths; ++i) {
+    bm.at(i) = HLTPathStatus(art::hlt::Fail);
+  }
+  check({"!p*"}, bm, true);
+  check({"p70"}, bm, false);
+
+  bm.at(70) = HLTPathStatus(art::hlt::Pass);
+  check({"p70"}, bm, true);
+  check({"p3"}, bm, false);
+  check({"!p*"}, bm, false);
+  check({"!p70"}, bm, false);
+  check({"p70&noexception"}, bm, true);
+
+  bm.at(99) = HLTPathStatus(art::hlt::Exception);
+  check({"exception@p99"}, bm, true);
+  check({"exception@p98"}, bm, false);
+  check({"p70&noexception"}, bm, false);
+  check({"p70"}, bm, true);
+}
+
 int
 main()
 {
@@ -178,5 +226,6 @@ main()
 
   // We are ready to run some tests
   testall(bit_qualified_paths, patterns, testmasks, ans);
+  testmany();
   return 0;
 }
@@ -44,9 +44,18 @@ namespace {
            art::ProductDescriptionsByID const& descriptions,
            std::vector<bool>& results)
   {
+    BOOST_TEST_REQUIRE(gs.nslots() == descriptions.size());
     for (auto const& p : descriptions) {
-      results.push_back(gs.selected(p.second));
+      auto const selected = gs.selected(p.second);
+      BOOST_TEST(gs.selected(p.first) == selected);
+      auto const slot = gs.slot(p.first);
+      BOOST_TEST_REQUIRE(slot != art::GroupSelector::invalid_slot);
+      BOOST_TEST(gs.productID(slot) == p.first);
+      BOOST_TEST(gs.selected(slot) == selected);
+      results.push_back(selected);
     }
+    BOOST_TEST(gs.slot(art::ProductID::invalid()) ==
+               art::GroupSelector::invalid_slot);
   }
 
   void
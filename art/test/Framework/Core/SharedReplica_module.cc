@@ -0,0 +1,57 @@
+#include "boost/test/unit_test.hpp"
+
+#include "art/Framework/Core/ReplicatedAnalyzer.h"
+#include "art/Framework/Principal/fwd.h"
+#include "art/Utilities/Globals.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Checks that a copy of a replicated module that is shared by several
+// schedules is never run concurrently, that it sees each run once, and
+// that each event is presented with the frame of the event's schedule.
+
+namespace {
+  class SharedReplica : public art::ReplicatedAnalyzer {
+  public:
+    struct Config {};
+    using Parameters = Table<Config>;
+    explicit SharedReplica(Parameters const& p,
+                           art::ProcessingFrame const& frame)
+      : ReplicatedAnalyzer{p, frame}, copy_{frame.scheduleID().id()}
+    {
+      BOOST_TEST(copy_ < art::Globals::instance()->nreplicas());
+    }
+
+  private:
+    void
+    beginRun(art::Run const&, art::ProcessingFrame const&) override
+    {
+      ++beginRuns_;
+    }
+
+    void
+    analyze(art::Event const&, art::ProcessingFrame const& frame) override
+    {
+      BOOST_TEST_REQUIRE(!busy_.exchange(true));
+      auto const sid = frame.scheduleID().id();
+      BOOST_TEST(sid < art::Globals::instance()->nschedules());
+      BOOST_TEST(sid % art::Globals::instance()->nreplicas() == copy_);
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+      busy_ = false;
+    }
+
+    void
+    endJob(art::ProcessingFrame const&) override
+    {
+      BOOST_TEST(beginRuns_ == 1u);
+    }
+
+    unsigned const copy_;
+    std::atomic<bool> busy_{false};
+    unsigned beginRuns_{};
+  };
+}
+
+DEFINE_ART_MODULE(SharedReplica)
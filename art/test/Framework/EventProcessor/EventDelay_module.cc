@@ -0,0 +1,39 @@
+#include "art/Framework/Core/SharedAnalyzer.h"
+#include "art/Framework/Principal/Event.h"
+#include "fhiclcpp/types/Atom.h"
+
+#include <chrono>
+#include <thread>
+
+// Spends an event-dependent amount of time on each event, so that
+// events processed on different schedules finish in a different order
+// from the one in which they were read.
+
+namespace {
+  class EventDelay : public art::SharedAnalyzer {
+  public:
+    struct Config {
+      fhicl::Atom<unsigned> maxDelay{
+        fhicl::Name{"maxDelay"},
+        fhicl::Comment{"Longest delay (in microseconds) for an event."}};
+    };
+    using Parameters = Table<Config>;
+    explicit EventDelay(Parameters const& p, art::ProcessingFrame const&)
+      : SharedAnalyzer{p}, maxDelay_{p().maxDelay()}
+    {
+      async<art::InEvent>();
+    }
+
+  private:
+    void
+    analyze(art::Event const& e, art::ProcessingFrame const&) override
+    {
+      std::this_thread::sleep_for(
+        std::chrono::microseconds{(e.event() * 7919u) % maxDelay_});
+    }
+
+    unsigned const maxDelay_;
+  };
+}
+
+DEFINE_ART_MODULE(EventDelay)
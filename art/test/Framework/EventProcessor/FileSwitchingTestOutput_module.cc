@@ -0,0 +1,174 @@
+#include "boost/test/unit_test.hpp"
+
+#include "art/Framework/Core/FileBlock.h"
+#include "art/Framework/Core/OutputModule.h"
+#include "art/Framework/IO/ClosingCriteria.h"
+#include "art/Framework/Principal/EventPrincipal.h"
+#include "art/Framework/Principal/RunPrincipal.h"
+#include "art/Framework/Principal/SubRunPrincipal.h"
+#include "art/Utilities/Globals.h"
+#include "canvas/Persistency/Provenance/RangeSet.h"
+#include "fhiclcpp/types/Atom.h"
+#include "fhiclcpp/types/ConfigurationTable.h"
+#include "fhiclcpp/types/Table.h"
+
+#include <set>
+#include <utility>
+#include <vector>
+
+// Checks the output "files" made when switching files according to
+// fileProperties.maxEvents:
+//
+//  - every event is written to exactly one file;
+//  - each file but the last holds at least maxEvents events, and at
+//    most nschedules-1 more, which were read before the event that
+//    filled it but were still being processed at the time;
+//  - the subrun range sets written to each file describe exactly the
+//    events that the file holds.
+
+using namespace art;
+
+namespace {
+  class FileSwitchingTestOutput : public OutputModule {
+  public:
+    struct Config {
+      fhicl::TableFragment<OutputModule::Config> omConfig;
+      fhicl::Table<ClosingCriteria::Config> fileProperties{
+        fhicl::Name("fileProperties")};
+      fhicl::Atom<unsigned> expectedEvents{fhicl::Name("expectedEvents")};
+    };
+
+    using Parameters =
+      fhicl::WrappedTable<Config, OutputModule::Config::KeysToIgnore>;
+    explicit FileSwitchingTestOutput(Parameters const& ps)
+      : OutputModule{ps().omConfig}
+      , closingCriteria_{ps().fileProperties()}
+      , expectedEvents_{ps().expectedEvents()}
+    {}
+
+  private:
+    struct File {
+      std::vector<EventID> events;
+      std::vector<std::pair<SubRunID, RangeSet>> subRunRanges;
+    };
+
+    void
+    openFile(FileBlock const&) override
+    {
+      BOOST_TEST_REQUIRE(!fileOpen_);
+      fileOpen_ = true;
+      fileProperties_ = FileProperties{};
+      files_.emplace_back();
+    }
+
+    bool
+    isFileOpen() const override
+    {
+      return fileOpen_;
+    }
+
+    void
+    finishEndFile() override
+    {
+      fileOpen_ = false;
+    }
+
+    void
+    write(EventPrincipal& ep) override
+    {
+      BOOST_TEST_REQUIRE(fileOpen_);
+      auto const& id = ep.eventID();
+      BOOST_TEST(written_.insert(id).second);
+      files_.back().events.push_back(id);
+      fileProperties_.update_event();
+    }
+
+    void
+    setSubRunAuxiliaryRangeSetID(RangeSet const& rs) override
+    {
+      subRunRangeSet_ = rs;
+    }
+
+    void
+    writeSubRun(SubRunPrincipal& srp) override
+    {
+      BOOST_TEST_REQUIRE(fileOpen_);
+      files_.back().subRunRanges.emplace_back(srp.subRunID(),
+                                              subRunRangeSet_);
+    }
+
+    void
+    writeRun(RunPrincipal&) override
+    {}
+
+    bool
+    requestsToCloseFile() const override
+    {
+      return closingCriteria_.should_close(fileProperties_);
+    }
+
+    Granularity
+    fileGranularity() const override
+    {
+      return closingCriteria_.granularity();
+    }
+
+    static bool
+    contains(File const& file, EventID const& id)
+    {
+      for (auto const& [subRun, rs] : file.subRunRanges) {
+        if (subRun != id.subRunID()) {
+          continue;
+        }
+        for (auto const& range : rs.ranges()) {
+          if (range.contains(id.subRun(), id.event())) {
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+
+    static std::size_t
+    rangesSize(File const& file)
+    {
+      std::size_t result{};
+      for (auto const& pr : file.subRunRanges) {
+        for (auto const& range : pr.second.ranges()) {
+          result += range.end() - range.begin();
+        }
+      }
+      return result;
+    }
+
+    void
+    endJob() override
+    {
+      BOOST_TEST(written_.size() == expectedEvents_);
+      BOOST_TEST_REQUIRE(!files_.empty());
+      auto const maxEvents = closingCriteria_.fileProperties().nEvents();
+      auto const slack = Globals::instance()->nschedules() - 1;
+      for (auto const& file : files_) {
+        auto const n = file.events.size();
+        if (&file != &files_.back()) {
+          BOOST_TEST(n >= maxEvents);
+        }
+        BOOST_TEST(n <= maxEvents + slack);
+        for (auto const& id : file.events) {
+          BOOST_TEST(contains(file, id), id << " not in the file's ranges");
+        }
+        BOOST_TEST(rangesSize(file) == n);
+      }
+    }
+
+    ClosingCriteria const closingCriteria_;
+    unsigned const expectedEvents_;
+    FileProperties fileProperties_{};
+    bool fileOpen_{false};
+    RangeSet subRunRangeSet_{RangeSet::invalid()};
+    std::vector<File> files_{};
+    std::set<EventID> written_{};
+  };
+}
+
+DEFINE_ART_MODULE(FileSwitchingTestOutput)
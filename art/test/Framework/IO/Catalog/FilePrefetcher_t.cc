@@ -0,0 +1,134 @@
+#define BOOST_TEST_MODULE (FilePrefetcher_t)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Framework/IO/Catalog/FilePrefetcher.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using art::FileDeliveryStatus;
+using art::FilePrefetcher;
+using art::FileTransferStatus;
+using namespace std::chrono_literals;
+
+namespace {
+  // Delivers the files "f0" ... "f<n-1>", then reports that there are
+  // no more files.
+  class FakeCatalog {
+  public:
+    explicit FakeCatalog(unsigned const n) : n_{n} {}
+
+    void
+    operator()(FilePrefetcher::Item& item, FilePrefetcher::pause_t const&)
+    {
+      auto const i = fetched_++;
+      if (i == n_) {
+        item.uriStatus = FileDeliveryStatus::NO_MORE_FILES;
+        return;
+      }
+      item.uri = "f" + std::to_string(i);
+      item.uriStatus = FileDeliveryStatus::SUCCESS;
+      item.pfn = "/scratch/" + item.uri;
+      item.ftStatus = FileTransferStatus::SUCCESS;
+    }
+
+    unsigned
+    fetched() const
+    {
+      return fetched_;
+    }
+
+  private:
+    unsigned const n_;
+    std::atomic<unsigned> fetched_{};
+  };
+
+  void
+  wait_for_fetches(FakeCatalog const& catalog, unsigned const n)
+  {
+    for (auto i = 0; i != 1000 && catalog.fetched() < n; ++i) {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+} // namespace
+
+BOOST_AUTO_TEST_CASE(files_in_order)
+{
+  FakeCatalog catalog{3};
+  FilePrefetcher prefetcher{2, std::ref(catalog)};
+  for (auto const* uri : {"f0", "f1", "f2"}) {
+    auto const item = prefetcher.next();
+    BOOST_TEST(item.uri == uri);
+    BOOST_TEST(item.pfn == std::string{"/scratch/"} + uri);
+  }
+  // The end is reported as often as it is asked for.
+  for (auto i = 0; i != 2; ++i) {
+    BOOST_TEST(prefetcher.next().uriStatus ==
+               FileDeliveryStatus::NO_MORE_FILES);
+  }
+  BOOST_TEST(catalog.fetched() == 4u);
+}
+
+BOOST_AUTO_TEST_CASE(bounded_look_ahead)
+{
+  FakeCatalog catalog{10};
+  FilePrefetcher prefetcher{3, std::ref(catalog)};
+  wait_for_fetches(catalog, 3);
+  std::this_thread::sleep_for(20ms);
+  BOOST_TEST(catalog.fetched() == 3u);
+
+  BOOST_TEST(prefetcher.next().uri == "f0");
+  wait_for_fetches(catalog, 4);
+  std::this_thread::sleep_for(20ms);
+  BOOST_TEST(catalog.fetched() == 4u);
+
+  // The files not taken are handed back for their disposition to be
+  // reported.
+  auto const remaining = prefetcher.stop();
+  BOOST_TEST_REQUIRE(remaining.size() == 3u);
+  BOOST_TEST(remaining.front().uri == "f1");
+  BOOST_TEST(remaining.back().uri == "f3");
+}
+
+BOOST_AUTO_TEST_CASE(error_is_sticky)
+{
+  FilePrefetcher prefetcher{
+    2, [](FilePrefetcher::Item& item, FilePrefetcher::pause_t const&) {
+      item.uri = "bad";
+      throw std::runtime_error("No such file");
+    }};
+  for (auto i = 0; i != 2; ++i) {
+    auto const item = prefetcher.next();
+    BOOST_TEST(item.uri == "bad");
+    BOOST_CHECK_THROW(std::rethrow_exception(item.error), std::runtime_error);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(stop_interrupts_pause)
+{
+  std::atomic<bool> paused{false};
+  FilePrefetcher prefetcher{
+    1,
+    [&paused](FilePrefetcher::Item& item,
+              FilePrefetcher::pause_t const& pause) {
+      item.uri = "slow";
+      item.uriStatus = FileDeliveryStatus::SUCCESS;
+      item.ftStatus = FileTransferStatus::UNAVAILABLE;
+      paused = true;
+      if (pause(3600.)) {
+        item.ftStatus = FileTransferStatus::SUCCESS;
+      }
+    }};
+  while (!paused) {
+    std::this_thread::sleep_for(1ms);
+  }
+  auto const start = std::chrono::steady_clock::now();
+  auto const remaining = prefetcher.stop();
+  BOOST_TEST((std::chrono::steady_clock::now() - start < 10s));
+  BOOST_TEST_REQUIRE(remaining.size() == 1u);
+  BOOST_TEST(remaining.front().uri == "slow");
+  BOOST_TEST(remaining.front().ftStatus == FileTransferStatus::UNAVAILABLE);
+}
@@ -0,0 +1,95 @@
+#define BOOST_TEST_MODULE (ClosingCriteria_t)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Framework/Core/OutputByteCounts.h"
+#include "art/Framework/IO/ClosingCriteria.h"
+
+#include <chrono>
+
+using art::ClosingCriteria;
+using art::FileProperties;
+using art::OutputByteCounts;
+
+namespace {
+  using Defaults = ClosingCriteria::Defaults;
+
+  ClosingCriteria
+  criteria(unsigned const maxEvents, unsigned const maxSizeKiB)
+  {
+    FileProperties const limits{maxEvents,
+                                Defaults::unsigned_max(),
+                                Defaults::unsigned_max(),
+                                Defaults::unsigned_max(),
+                                maxSizeKiB,
+                                std::chrono::seconds{
+                                  Defaults::seconds_max()}};
+    return ClosingCriteria{limits, "Event"};
+  }
+
+  void
+  writeEvents(OutputByteCounts& bytes,
+              unsigned const n,
+              std::uint64_t const compressed)
+  {
+    for (unsigned i{}; i != n; ++i) {
+      bytes.record(art::InEvent, 2 * compressed, compressed);
+      bytes.recordEntry(art::InEvent);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(ClosingCriteria_t)
+
+BOOST_AUTO_TEST_CASE(byte_counts)
+{
+  OutputByteCounts bytes;
+  BOOST_TEST(bytes.meanCompressed(art::InEvent) == 0.);
+  writeEvents(bytes, 4, 100);
+  bytes.record(art::InSubRun, 30, 10);
+  BOOST_TEST(bytes.entries(art::InEvent) == 4u);
+  BOOST_TEST(bytes.compressed(art::InEvent) == 400u);
+  BOOST_TEST(bytes.serialized() == 830u);
+  BOOST_TEST(bytes.compressed() == 410u);
+  BOOST_TEST(bytes.meanCompressed(art::InEvent) == 100.);
+  bytes.reset();
+  BOOST_TEST(bytes.compressed() == 0u);
+  BOOST_TEST(bytes.entries(art::InEvent) == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(close_before_exceeding_size)
+{
+  auto const cc = criteria(Defaults::unsigned_max(), 10); // 10240 bytes
+  FileProperties const fp;
+  OutputByteCounts bytes;
+  BOOST_TEST(!cc.should_close(fp, bytes));
+  BOOST_TEST(!cc.eventsUntilClose(fp, bytes).has_value());
+
+  writeEvents(bytes, 4, 2000);
+  BOOST_TEST(!cc.should_close(fp, bytes));
+  BOOST_TEST(*cc.eventsUntilClose(fp, bytes) == 1u);
+
+  // A fifth event leaves less room than an average event needs.
+  writeEvents(bytes, 1, 2000);
+  BOOST_TEST(cc.should_close(fp, bytes));
+  BOOST_TEST(*cc.eventsUntilClose(fp, bytes) == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(events_until_close_uses_tighter_limit)
+{
+  auto const cc = criteria(3, 1024); // 1 MiB
+  FileProperties fp;
+  OutputByteCounts bytes;
+  BOOST_TEST(*cc.eventsUntilClose(fp, bytes) == 3u);
+
+  fp.update_event();
+  writeEvents(bytes, 1, 1000);
+  BOOST_TEST(*cc.eventsUntilClose(fp, bytes) == 2u);
+  BOOST_TEST(!cc.should_close(fp, bytes));
+
+  fp.update_event();
+  fp.update_event();
+  BOOST_TEST(*cc.eventsUntilClose(fp, bytes) == 0u);
+  BOOST_TEST(cc.should_close(fp, bytes));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
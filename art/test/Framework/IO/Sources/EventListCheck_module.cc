@@ -0,0 +1,73 @@
+#include "art/Framework/Core/EDAnalyzer.h"
+#include "art/Framework/Principal/Event.h"
+#include "art/Framework/Principal/SubRun.h"
+#include "canvas/Persistency/Provenance/EventID.h"
+#include "canvas/Utilities/Exception.h"
+#include "fhiclcpp/types/Sequence.h"
+#include "fhiclcpp/types/Tuple.h"
+
+#include <set>
+#include <tuple>
+#include <vector>
+
+// Checks that exactly the expected events, given as (run, subrun,
+// event) triples, and the subruns containing them, are processed.
+
+namespace {
+  class EventListCheck : public art::EDAnalyzer {
+  public:
+    struct Config {
+      fhicl::Sequence<fhicl::Tuple<unsigned, unsigned, unsigned>>
+        expectedEvents{fhicl::Name{"expectedEvents"}};
+    };
+    using Parameters = Table<Config>;
+    explicit EventListCheck(Parameters const& p) : EDAnalyzer{p}
+    {
+      for (auto const& [r, sr, e] : p().expectedEvents()) {
+        expectedEvents_.emplace(r, sr, e);
+        expectedSubRuns_.insert(art::SubRunID{r, sr});
+      }
+    }
+
+  private:
+    void
+    beginSubRun(art::SubRun const& sr) override
+    {
+      if (!seenSubRuns_.insert(sr.id()).second) {
+        throw art::Exception{art::errors::LogicError}
+          << "SubRun " << sr.id() << " was processed more than once.\n";
+      }
+    }
+
+    void
+    analyze(art::Event const& e) override
+    {
+      if (!seenEvents_.insert(e.id()).second) {
+        throw art::Exception{art::errors::LogicError}
+          << "Event " << e.id() << " was processed more than once.\n";
+      }
+    }
+
+    void
+    endJob() override
+    {
+      if (seenEvents_ != expectedEvents_) {
+        throw art::Exception{art::errors::LogicError}
+          << "Processed " << seenEvents_.size() << " events instead of the "
+          << expectedEvents_.size() << " expected ones.\n";
+      }
+      if (seenSubRuns_ != expectedSubRuns_) {
+        throw art::Exception{art::errors::LogicError}
+          << "Processed " << seenSubRuns_.size() << " subruns instead of the "
+          << expectedSubRuns_.size() << " expected ones.\n";
+      }
+    }
+
+    std::set<art::EventID> expectedEvents_{};
+    std::set<art::SubRunID> expectedSubRuns_{};
+    std::set<art::EventID> seenEvents_{};
+    std::set<art::SubRunID> seenSubRuns_{};
+  };
+}
+
+DEFINE_ART_MODULE(EventListCheck)
@@ -0,0 +1,71 @@
+#define BOOST_TEST_MODULE (EventList_t)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Framework/IO/Sources/detail/EventList.h"
+#include "canvas/Utilities/Exception.h"
+
+#include <fstream>
+#include <string>
+
+using art::EventID;
+using art::RunID;
+using art::SubRunID;
+using art::detail::EventList;
+
+BOOST_AUTO_TEST_CASE(no_selection)
+{
+  EventList const list{{}, {}};
+  BOOST_TEST(!list);
+  BOOST_TEST(!list.done());
+  BOOST_TEST(list.wants(RunID{7}));
+  BOOST_TEST(list.wants(EventID{7, 0, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(selection)
+{
+  std::string const filename{"EventList_t.txt"};
+  std::ofstream{filename} << "# From the skim\n"
+                          << "\n"
+                          << "3:1:10\n"
+                          << " 1:2:5 \n";
+  EventList list{{"3:0:4", "3:1:10"}, filename};
+  BOOST_TEST(!!list);
+
+  BOOST_TEST(list.wants(RunID{1}));
+  BOOST_TEST(!list.wants(RunID{2}));
+  BOOST_TEST(list.wants(SubRunID{1, 2}));
+  BOOST_TEST(!list.wants(SubRunID{1, 3}));
+  BOOST_TEST(list.wants(EventID{3, 1, 10}));
+  BOOST_TEST(!list.wants(EventID{3, 1, 11}));
+
+  BOOST_TEST(*list.nextAfter(std::nullopt) == (EventID{1, 2, 5}));
+  BOOST_TEST(*list.nextAfter(EventID{2, 0, 1}) == (EventID{3, 0, 4}));
+  BOOST_TEST(*list.nextAfter(EventID{3, 0, 4}) == (EventID{3, 1, 10}));
+  BOOST_TEST(!list.nextAfter(EventID{3, 1, 10}));
+
+  list.delivered(EventID{3, 0, 4});
+  BOOST_TEST(!list.wants(SubRunID{3, 0}));
+  BOOST_TEST(list.wants(RunID{3}));
+  list.delivered(EventID{1, 2, 5});
+  list.delivered(EventID{3, 1, 10});
+  BOOST_TEST(list.done());
+}
+
+BOOST_AUTO_TEST_CASE(skipped_subrun)
+{
+  EventList list{{"1:0:3", "1:1:2", "1:1:8", "1:2:1"}, {}};
+  list.skipped(SubRunID{1, 1});
+  BOOST_TEST(!list.wants(SubRunID{1, 1}));
+  BOOST_TEST(*list.nextAfter(EventID{1, 0, 3}) == (EventID{1, 2, 1}));
+  list.skipped(SubRunID{1, 5});
+  list.delivered(EventID{1, 0, 3});
+  list.delivered(EventID{1, 2, 1});
+  BOOST_TEST(list.done());
+}
+
+BOOST_AUTO_TEST_CASE(bad_specification)
+{
+  BOOST_CHECK_THROW((EventList{{"1:2"}, {}}), art::Exception);
+  BOOST_CHECK_THROW((EventList{{"1:0:0"}, {}}), art::Exception);
+  BOOST_CHECK_THROW((EventList{{}, "EventList_t_missing.txt"}), art::Exception);
+}
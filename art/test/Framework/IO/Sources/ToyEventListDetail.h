@@ -0,0 +1,195 @@
+#ifndef art_test_Framework_IO_Sources_ToyEventListDetail_h
+#define art_test_Framework_IO_Sources_ToyEventListDetail_h
+// vim: set sw=2 expandtab :
+
+// ======================================================================
+// ToyEventListDetail
+//
+// A Source<T> detail class for testing the 'eventList' parameter.
+// Every input "file" holds the same events: subruns 0 to nSubRuns-1 of
+// run 1, each with events 1 to nEventsPerSubRun.  When the file is
+// closed, the number of events actually made by readNext is checked
+// against the 'expectedReads' or 'maxReads' parameter, whichever is
+// given.
+//
+// ToySeekingEventListDetail also provides seekEvent, so that Source<T>
+// can skip unselected events without reading them.  The number of
+// seekEvent calls is checked against the optional 'expectedSeeks'
+// parameter.
+// ======================================================================
+
+#include "art/Framework/Core/FileBlock.h"
+#include "art/Framework/Core/ProductRegistryHelper.h"
+#include "art/Framework/IO/Sources/SourceHelper.h"
+#include "art/Framework/IO/Sources/SourceTraits.h"
+#include "art/Framework/Principal/EventPrincipal.h"
+#include "art/Framework/Principal/RunPrincipal.h"
+#include "art/Framework/Principal/SubRunPrincipal.h"
+#include "canvas/Persistency/Provenance/EventID.h"
+#include "canvas/Persistency/Provenance/FileFormatVersion.h"
+#include "canvas/Persistency/Provenance/Timestamp.h"
+#include "canvas/Utilities/Exception.h"
+#include "fhiclcpp/ParameterSet.h"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+
+namespace arttest {
+
+  class ToyEventListDetail {
+  public:
+    ToyEventListDetail(fhicl::ParameterSet const& ps,
+                       art::ProductRegistryHelper&,
+                       art::SourceHelper const& sh)
+      : sh_{sh}
+      , nSubRuns_{ps.get<unsigned>("nSubRuns", 3)}
+      , nEvents_{ps.get<unsigned>("nEventsPerSubRun", 10)}
+      , expectedReads_{ps.get_if_present<unsigned>("expectedReads")}
+      , maxReads_{ps.get_if_present<unsigned>("maxReads")}
+    {}
+
+    void
+    readFile(std::string const& name, art::FileBlock*& fb)
+    {
+      fb = new art::FileBlock{art::FileFormatVersion{1, "ToyEventList"}, name};
+      next_ = art::EventID{1, 0, 1};
+      reads_ = 0;
+    }
+
+    bool
+    readNext(art::RunPrincipal const* const inR,
+             art::SubRunPrincipal const* const inSR,
+             art::RunPrincipal*& outR,
+             art::SubRunPrincipal*& outSR,
+             art::EventPrincipal*& outE)
+    {
+      if (!next_) {
+        return false;
+      }
+      auto const id = *next_;
+      art::Timestamp const ts{};
+      if (inR == nullptr || inR->run() != id.run()) {
+        outR = sh_.makeRunPrincipal(id.run(), ts);
+      }
+      if (inSR == nullptr || inSR->subRunID() != id.subRunID()) {
+        outSR = sh_.makeSubRunPrincipal(id.run(), id.subRun(), ts);
+      }
+      outE = sh_.makeEventPrincipal(id.run(), id.subRun(), id.event(), ts);
+      ++reads_;
+      next_ = after_(id);
+      return true;
+    }
+
+    void
+    closeCurrentFile()
+    {
+      if (expectedReads_ && reads_ != *expectedReads_) {
+        throw art::Exception{art::errors::LogicError}
+          << "Read " << reads_ << " events from the file instead of "
+          << *expectedReads_ << ".\n";
+      }
+      if (maxReads_ && reads_ > *maxReads_) {
+        throw art::Exception{art::errors::LogicError}
+          << "Read " << reads_ << " events from the file instead of at most "
+          << *maxReads_ << ".\n";
+      }
+    }
+
+  protected:
+    // Positions the reader at the first event of the file not before id.
+    bool
+    seek_(art::EventID const& id)
+    {
+      if (id.run() != 1 || id.subRun() >= nSubRuns_) {
+        next_.reset();
+      } else if (id.event() > nEvents_) {
+        next_ = after_(art::EventID{id.run(), id.subRun(), nEvents_});
+      } else {
+        next_ = art::EventID{
+          id.run(), id.subRun(), std::max(id.event(), art::EventNumber_t{1})};
+      }
+      return next_.has_value();
+    }
+
+  private:
+    std::optional<art::EventID>
+    after_(art::EventID const& id) const
+    {
+      if (id.event() < nEvents_) {
+        return id.next();
+      }
+      if (id.subRun() + 1 < nSubRuns_) {
+        return art::EventID{id.run(), id.subRun() + 1, 1};
+      }
+      return std::nullopt;
+    }
+
+    art::SourceHelper const& sh_;
+    unsigned const nSubRuns_;
+    unsigned const nEvents_;
+    std::optional<unsigned> const expectedReads_;
+    std::optional<unsigned> const maxReads_;
+    std::optional<art::EventID> next_{};
+    unsigned reads_{};
+  };
+
+  class ToySeekingEventListDetail : public ToyEventListDetail {
+  public:
+    ToySeekingEventListDetail(fhicl::ParameterSet const& ps,
+                              art::ProductRegistryHelper& h,
+                              art::SourceHelper const& sh)
+      : ToyEventListDetail{ps, h, sh}
+      , expectedSeeks_{ps.get_if_present<unsigned>("expectedSeeks")}
+    {}
+
+    void
+    readFile(std::string const& name, art::FileBlock*& fb)
+    {
+      ToyEventListDetail::readFile(name, fb);
+      seeks_ = 0;
+    }
+
+    bool
+    seekEvent(art::EventID const& id)
+    {
+      ++seeks_;
+      return seek_(id);
+    }
+
+    void
+    closeCurrentFile()
+    {
+      ToyEventListDetail::closeCurrentFile();
+      if (expectedSeeks_ && seeks_ != *expectedSeeks_) {
+        throw art::Exception{art::errors::LogicError}
+          << "seekEvent was called " << seeks_ << " times instead of "
+          << *expectedSeeks_ << ".\n";
+      }
+    }
+
+  private:
+    std::optional<unsigned> const expectedSeeks_;
+    unsigned seeks_{};
+  };
+
+} // namespace arttest
+
+// The file names are not real files.
+namespace art {
+  template <>
+  struct Source_wantFileServices<arttest::ToyEventListDetail> {
+    static constexpr bool value = false;
+  };
+
+  template <>
+  struct Source_wantFileServices<arttest::ToySeekingEventListDetail> {
+    static constexpr bool value = false;
+  };
+} // namespace art
+
+#endif /* art_test_Framework_IO_Sources_ToyEventListDetail_h */
+
+// Local Variables:
+// mode: c++
+// End:
@@ -0,0 +1,9 @@
+#include "art/Framework/Core/InputSourceMacros.h"
+#include "art/Framework/IO/Sources/Source.h"
+#include "art/test/Framework/IO/Sources/ToyEventListDetail.h"
+
+namespace arttest {
+  using ToyEventListSource = art::Source<ToyEventListDetail>;
+}
+
+DEFINE_ART_INPUT_SOURCE(arttest::ToyEventListSource)
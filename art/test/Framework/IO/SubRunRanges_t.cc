@@ -0,0 +1,85 @@
+#define BOOST_TEST_MODULE (SubRunRanges_t)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Framework/IO/detail/SubRunRanges.h"
+
+#include <set>
+#include <vector>
+
+using art::SubRunID;
+using art::detail::SubRunRanges;
+
+namespace {
+  std::vector<SubRunID>
+  contents(SubRunRanges const& ranges)
+  {
+    return {ranges.begin(), ranges.end()};
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(SubRunRanges_t)
+
+BOOST_AUTO_TEST_CASE(empty)
+{
+  SubRunRanges const ranges;
+  BOOST_TEST(ranges.empty());
+  BOOST_TEST(ranges.size() == 0u);
+  BOOST_TEST(!ranges.contains(SubRunID{1, 0}));
+  BOOST_TEST((ranges.begin() == ranges.end()));
+}
+
+BOOST_AUTO_TEST_CASE(consecutive_subruns_share_a_range)
+{
+  SubRunRanges ranges;
+  for (unsigned sr{}; sr != 10000; ++sr) {
+    BOOST_TEST(ranges.insert(SubRunID{1, sr}));
+  }
+  BOOST_TEST(!ranges.insert(SubRunID{1, 42}));
+  BOOST_TEST(ranges.size() == 10000u);
+  BOOST_TEST(ranges.nRanges() == 1u);
+  BOOST_TEST(ranges.contains(SubRunID{1, 9999}));
+  BOOST_TEST(!ranges.contains(SubRunID{1, 10000}));
+  BOOST_TEST(!ranges.contains(SubRunID{2, 0}));
+}
+
+BOOST_AUTO_TEST_CASE(out_of_order_insertion)
+{
+  // Compared against std::set, which FileStatsCollector used to hold.
+  std::vector<SubRunID> const ids{{2, 5},
+                                  {1, 3},
+                                  {2, 3},
+                                  {1, 1},
+                                  {2, 4},
+                                  {1, 2},
+                                  {3, 0},
+                                  {1, 7},
+                                  {2, 5},
+                                  {1, 8}};
+  SubRunRanges ranges;
+  std::set<SubRunID> expected;
+  for (auto const& id : ids) {
+    BOOST_TEST(ranges.insert(id) == expected.insert(id).second);
+  }
+  BOOST_TEST(ranges.size() == expected.size());
+  // [1:1-3], [1:7-8], [2:3-5], [3:0]
+  BOOST_TEST(ranges.nRanges() == 4u);
+  auto const result = contents(ranges);
+  std::vector<SubRunID> const expectedv(expected.cbegin(), expected.cend());
+  BOOST_TEST(result == expectedv, boost::test_tools::per_element());
+  for (auto const& id : ids) {
+    BOOST_TEST(ranges.contains(id));
+  }
+  BOOST_TEST(!ranges.contains(SubRunID{1, 4}));
+
+  // Filling the gap merges the neighbouring ranges.
+  for (unsigned sr{4}; sr != 7; ++sr) {
+    ranges.insert(SubRunID{1, sr});
+  }
+  BOOST_TEST(ranges.nRanges() == 3u);
+
+  ranges.clear();
+  BOOST_TEST(ranges.empty());
+  BOOST_TEST(ranges.nRanges() == 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,48 @@
+#define BOOST_TEST_MODULE (ParentageCache_t)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Framework/Principal/ParentageCache.h"
+#include "canvas/Persistency/Provenance/Parentage.h"
+#include "canvas/Persistency/Provenance/ParentageRegistry.h"
+
+#include <set>
+#include <vector>
+
+using namespace art;
+
+namespace {
+  ProductID const a{"A"};
+  ProductID const b{"B"};
+}
+
+BOOST_AUTO_TEST_SUITE(ParentageCache_t)
+
+BOOST_AUTO_TEST_CASE(same_parents)
+{
+  ParentageCache cache;
+  std::set<ProductID> const parents{a, b};
+  auto const id = cache.id(parents);
+  BOOST_TEST(id.isValid());
+  Parentage const expected{
+    std::vector<ProductID>(cbegin(parents), cend(parents))};
+  BOOST_TEST(id == expected.id());
+  BOOST_TEST(cache.id(parents) == id);
+
+  Parentage registered;
+  BOOST_TEST(ParentageRegistry::get(id, registered));
+  BOOST_TEST(registered.id() == id);
+}
+
+BOOST_AUTO_TEST_CASE(changed_parents)
+{
+  ParentageCache cache;
+  auto const none = cache.id({});
+  BOOST_TEST(none == Parentage{}.id());
+  auto const one = cache.id({a});
+  BOOST_TEST(one != none);
+  auto const two = cache.id({a, b});
+  BOOST_TEST(two != one);
+  BOOST_TEST(cache.id({a}) == one);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
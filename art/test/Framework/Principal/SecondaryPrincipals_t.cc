@@ -0,0 +1,100 @@
+#define BOOST_TEST_MODULE (SecondaryPrincipals_t)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Framework/Principal/DelayedReader.h"
+#include "art/Framework/Principal/Principal.h"
+#include "canvas/Persistency/Provenance/ProcessConfiguration.h"
+#include "canvas/Persistency/Provenance/ProcessHistoryID.h"
+#include "fhiclcpp/ParameterSetID.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace art;
+
+namespace {
+
+  ProcessConfiguration const pc{"TEST", fhicl::ParameterSetID{}, "v1"};
+
+  // Hands out 'n' empty secondary principals, counting the number of
+  // times it is asked for one.
+  class SecondaryReader : public DelayedReader {
+  public:
+    explicit SecondaryReader(int const n, std::atomic<int>& calls)
+      : n_{n}, calls_{calls}
+    {}
+
+  private:
+    std::unique_ptr<EDProduct>
+    getProduct_(Group const*, ProductID, RangeSet&) const override
+    {
+      return nullptr;
+    }
+
+    std::unique_ptr<Principal>
+    readFromSecondaryFile_(int& idx) override
+    {
+      ++calls_;
+      if (idx == n_) {
+        return nullptr;
+      }
+      ++idx;
+      return std::make_unique<Principal>(
+        InEvent, pc, nullptr, ProcessHistoryID{});
+    }
+
+    int const n_;
+    std::atomic<int>& calls_;
+  };
+
+  std::unique_ptr<Principal>
+  makePrincipal(int const nSecondaries, std::atomic<int>& calls)
+  {
+    return std::make_unique<Principal>(
+      InEvent,
+      pc,
+      nullptr,
+      ProcessHistoryID{},
+      std::make_unique<SecondaryReader>(nSecondaries, calls));
+  }
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SecondaryPrincipals_t)
+
+BOOST_AUTO_TEST_CASE(concurrent_lookups)
+{
+  std::atomic<int> calls{};
+  auto const p = makePrincipal(3, calls);
+  ProductID const missing{"missing"};
+  std::atomic<int> failures{};
+  std::vector<std::thread> threads;
+  for (int i{}; i != 8; ++i) {
+    threads.emplace_back([&p, &failures, missing] {
+      if (p->getByProductID(missing).failed()) {
+        ++failures;
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  BOOST_TEST(failures.load() == 8);
+  // Each secondary file is opened once, after which the reader is
+  // asked only once more.
+  BOOST_TEST(calls.load() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(eager_opening)
+{
+  std::atomic<int> calls{};
+  auto const p = makePrincipal(2, calls);
+  p->openAllSecondaryFiles();
+  BOOST_TEST(calls.load() == 3);
+  BOOST_TEST(p->getByProductID(ProductID{"missing"}).failed());
+  BOOST_TEST(calls.load() == 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,50 @@
+// vim: set sw=2 expandtab :
+#define BOOST_TEST_MODULE (LatencyHistogram test)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Framework/Services/Optional/detail/LatencyHistogram.h"
+
+using art::detail::LatencyHistogram;
+using namespace std::chrono_literals;
+
+BOOST_AUTO_TEST_SUITE(LatencyHistogram_t)
+
+BOOST_AUTO_TEST_CASE(bins)
+{
+  BOOST_TEST(LatencyHistogram::bin(0ns) == 0u);
+  BOOST_TEST(LatencyHistogram::bin(999ns) == 0u);
+  // Each bin's upper edge lies beyond the durations it holds.
+  for (std::chrono::microseconds const d :
+       {1us, 3us, 17us, 1000us, 250000us, 3000000us}) {
+    auto const b = LatencyHistogram::bin(d);
+    BOOST_TEST(LatencyHistogram::upperEdge(b) > 1.e-6 * d.count());
+    BOOST_TEST(LatencyHistogram::upperEdge(b - 1) <= 1.e-6 * d.count());
+  }
+  BOOST_TEST(LatencyHistogram::bin(1000h) == LatencyHistogram::nbins - 1);
+}
+
+BOOST_AUTO_TEST_CASE(quantiles_over_window)
+{
+  LatencyHistogram h;
+  LatencyHistogram::counts_t const empty{};
+  BOOST_TEST(LatencyHistogram::quantile(h.counts(), empty, 0.5) == 0.);
+
+  for (int i{}; i != 99; ++i) {
+    h.record(10us);
+  }
+  h.record(1s);
+  auto const earlier = h.counts();
+  BOOST_TEST(LatencyHistogram::quantile(earlier, empty, 0.5) < 20.e-6);
+  BOOST_TEST(LatencyHistogram::quantile(earlier, empty, 0.99) < 20.e-6);
+  BOOST_TEST(LatencyHistogram::quantile(earlier, empty, 1.) > 1.);
+
+  // Only the entries recorded since 'earlier' are counted.
+  for (int i{}; i != 10; ++i) {
+    h.record(2ms);
+  }
+  auto const q = LatencyHistogram::quantile(h.counts(), earlier, 0.5);
+  BOOST_TEST(q > 2.e-3);
+  BOOST_TEST(q < 3.e-3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
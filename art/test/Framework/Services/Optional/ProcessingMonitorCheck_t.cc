@@ -0,0 +1,86 @@
+// vim: set sw=2 expandtab :
+#define BOOST_TEST_MODULE (ProcessingMonitorCheck test)
+#include "boost/test/unit_test.hpp"
+
+#include "boost/property_tree/json_parser.hpp"
+#include "boost/property_tree/ptree.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Checks the JSON lines written by the ProcessingMonitor service in
+// the ProcessingMonitor_t test, whose output file is given as the
+// argument (see CMakeLists.txt).
+
+namespace pt = boost::property_tree;
+
+namespace {
+  // The fractions are written with six significant digits.
+  constexpr double tolerance{1.e-5};
+
+  std::vector<pt::ptree>
+  read_lines(std::string const& filename)
+  {
+    std::vector<pt::ptree> result;
+    std::ifstream in{filename};
+    BOOST_TEST_REQUIRE(in.good(), "Could not open " << filename);
+    std::string line;
+    while (std::getline(in, line)) {
+      std::istringstream is{line};
+      pt::ptree tree;
+      pt::read_json(is, tree);
+      result.push_back(std::move(tree));
+    }
+    return result;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(monitor_output)
+{
+  auto const& suite = boost::unit_test::framework::master_test_suite();
+  if (suite.argc < 2) {
+    return;
+  }
+  auto const lines = read_lines(suite.argv[1]);
+  BOOST_TEST_REQUIRE(!lines.empty());
+
+  for (auto const& line : lines) {
+    BOOST_TEST(line.get<unsigned long>("events") <= 100u);
+    BOOST_TEST(line.get<double>("events_per_second") >= 0.);
+    BOOST_TEST(line.get<double>("window") > 0.);
+
+    auto const& schedules = line.get_child("schedules");
+    BOOST_TEST_REQUIRE(schedules.size() == 3u);
+    unsigned i{};
+    for (auto const& [key, schedule] : schedules) {
+      BOOST_TEST(schedule.get<unsigned>("schedule") == i++);
+      auto const idle = schedule.get<double>("idle_fraction");
+      BOOST_TEST(idle >= 0.);
+      BOOST_TEST(idle <= 1.);
+      BOOST_TEST(schedule.get<double>("input_wait_fraction") >= 0.);
+      BOOST_TEST(schedule.get<double>("output_wait_fraction") >= 0.);
+    }
+
+    for (auto const& [name, module] : line.get_child("modules")) {
+      BOOST_TEST(module.get<double>("p50") <= module.get<double>("p99"),
+                 name);
+    }
+  }
+
+  // The last line is written at the end of the job, and its window
+  // covers the whole job, in which the waits of a schedule are parts of
+  // its idle time.
+  auto const& last = lines.back();
+  BOOST_TEST(last.get<unsigned long>("events") == 100u);
+  for (auto const& [key, schedule] : last.get_child("schedules")) {
+    BOOST_TEST(schedule.get<double>("input_wait_fraction") +
+                 schedule.get<double>("output_wait_fraction") <=
+               schedule.get<double>("idle_fraction") + tolerance);
+  }
+  auto const& modules = last.get_child("modules");
+  for (auto const name : {"a1", "f1", "o1(write)"}) {
+    BOOST_TEST(modules.count(name) == 1u, name << " is not listed");
+  }
+}
@@ -0,0 +1,174 @@
+#define BOOST_TEST_MODULE (CollectionUtilities_t)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Persistency/Common/CollectionUtilities.h"
+#include "cetlib/map_vector.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+using namespace art;
+
+namespace {
+  struct Hit {
+    int channel{};
+    double charge{};
+    bool
+    operator==(Hit const& other) const
+    {
+      return channel == other.channel && charge == other.charge;
+    }
+  };
+
+  std::vector<Hit>
+  make_hits(std::size_t const n, int const first_channel)
+  {
+    std::vector<Hit> result(n);
+    for (std::size_t i = 0; i != n; ++i) {
+      result[i] = Hit{first_channel + static_cast<int>(i), 0.5 * i};
+    }
+    return result;
+  }
+
+  static_assert(detail::supports_parallel_flatten<std::vector<Hit>>::value);
+  static_assert(!detail::supports_parallel_flatten<std::vector<bool>>::value);
+  static_assert(!detail::supports_parallel_flatten<PtrVector<Hit>>::value);
+  static_assert(
+    !detail::supports_parallel_flatten<cet::map_vector<Hit>>::value);
+
+  // A collection that can be flattened in parallel, but whose offsets
+  // are not its sizes.
+  struct PaddedHits : std::vector<Hit> {
+    using std::vector<Hit>::vector;
+  };
+  static_assert(detail::supports_parallel_flatten<PaddedHits>::value);
+}
+
+template <>
+struct art::detail::mix_offset<PaddedHits> {
+  static std::size_t
+  offset(PaddedHits const& hits)
+  {
+    return hits.size() + 10;
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(CollectionUtilities_t)
+
+BOOST_AUTO_TEST_CASE(parallel_matches_serial)
+{
+  // Sizes chosen so that collections straddle the parallel chunks,
+  // including empty and null collections.
+  auto const a = make_hits(100'000, 0);
+  auto const b = make_hits(0, 0);
+  auto const c = make_hits(7, 1'000'000);
+  auto const d = make_hits(50'001, 2'000'000);
+  std::vector<std::vector<Hit> const*> const in{&a, &b, nullptr, &c, &d};
+
+  std::vector<Hit> serial;
+  std::vector<std::size_t> serial_offsets;
+  flattenCollections(in, serial, serial_offsets);
+
+  std::vector<Hit> parallel;
+  std::vector<std::size_t> parallel_offsets;
+  flattenCollectionsInParallel(in, parallel, parallel_offsets);
+
+  BOOST_TEST(serial_offsets == parallel_offsets);
+  BOOST_TEST_REQUIRE(serial.size() == parallel.size());
+  BOOST_TEST((serial == parallel));
+}
+
+BOOST_AUTO_TEST_CASE(parallel_offsets_use_mix_offset)
+{
+  PaddedHits const a(40'000);
+  PaddedHits const b(3);
+  PaddedHits const c(20'000);
+  std::vector<PaddedHits const*> const in{&a, nullptr, &b, &c};
+
+  PaddedHits serial;
+  std::vector<std::size_t> serial_offsets;
+  flattenCollections(in, serial, serial_offsets);
+
+  PaddedHits parallel;
+  std::vector<std::size_t> parallel_offsets;
+  flattenCollectionsInParallel(in, parallel, parallel_offsets);
+
+  std::vector<std::size_t> const expected{0, 40'010, 40'023};
+  BOOST_TEST(serial_offsets == expected);
+  BOOST_TEST(parallel_offsets == expected);
+  BOOST_TEST((serial == parallel));
+}
+
+BOOST_AUTO_TEST_CASE(map_vector_offsets)
+{
+  cet::map_vector<Hit> a;
+  a[cet::map_vector_key{2}] = Hit{2, 1.};
+  a[cet::map_vector_key{9}] = Hit{9, 2.};
+  cet::map_vector<Hit> b;
+  b[cet::map_vector_key{4}] = Hit{4, 3.};
+  std::vector<cet::map_vector<Hit> const*> const in{&a, &b};
+
+  cet::map_vector<Hit> serial;
+  std::vector<std::size_t> serial_offsets;
+  flattenCollections(in, serial, serial_offsets);
+
+  cet::map_vector<Hit> parallel;
+  std::vector<std::size_t> parallel_offsets;
+  flattenCollectionsInParallel(in, parallel, parallel_offsets);
+
+  BOOST_TEST(serial_offsets == (std::vector<std::size_t>{0, a.delta()}));
+  BOOST_TEST(parallel_offsets == serial_offsets);
+  BOOST_TEST_REQUIRE(parallel.size() == serial.size());
+  BOOST_TEST(std::equal(
+    parallel.begin(), parallel.end(), serial.begin(), serial.end()));
+}
+
+BOOST_AUTO_TEST_CASE(appends_to_existing_output)
+{
+  auto const a = make_hits(3, 10);
+  auto const b = make_hits(40'000, 20);
+  std::vector<std::vector<Hit> const*> const in{&a, &b};
+
+  auto serial = make_hits(2, -2);
+  flattenCollections(in, serial);
+  auto parallel = make_hits(2, -2);
+  flattenCollectionsInParallel(in, parallel);
+  BOOST_TEST((serial == parallel));
+}
+
+BOOST_AUTO_TEST_CASE(empty_input)
+{
+  std::vector<std::vector<Hit> const*> const in{nullptr};
+  std::vector<Hit> out;
+  std::vector<std::size_t> offsets{42};
+  flattenCollectionsInParallel(in, out, offsets);
+  BOOST_TEST(out.empty());
+  BOOST_TEST(offsets.empty());
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for_segments_covers_everything)
+{
+  std::vector<std::size_t> const starts{0, 0, 5, 70'000, 70'000};
+  std::size_t const total{100'000};
+  std::vector<int> seen(total);
+  detail::parallel_for_segments(
+    starts,
+    total,
+    [&starts, &seen](std::size_t const i,
+                     std::size_t const b,
+                     std::size_t const e,
+                     std::size_t const d) {
+      BOOST_CHECK(b < e);
+      BOOST_CHECK(d == starts[i] + b);
+      for (auto k = d; k != d + (e - b); ++k) {
+        ++seen[k];
+      }
+    });
+  BOOST_TEST(std::accumulate(seen.cbegin(), seen.cend(), 0) ==
+             static_cast<int>(total));
+  BOOST_TEST(*std::min_element(seen.cbegin(), seen.cend()) == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
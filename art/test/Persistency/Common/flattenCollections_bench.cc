@@ -0,0 +1,95 @@
+// ======================================================================
+// Benchmark of flattening many secondary-event collections into one,
+// as done when mixing pileup events.
+//
+// Compares art::flattenCollections (serial concatenation) with
+// art::flattenCollectionsInParallel.
+//
+// Usage: flattenCollections_bench [nsecondaries [elements-per-secondary]]
+// ======================================================================
+
+#include "art/Persistency/Common/CollectionUtilities.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+  struct Hit {
+    int channel;
+    int tdc;
+    double charge;
+    double time;
+  };
+
+  template <typename F>
+  double
+  time_ms(F f, int const repetitions)
+  {
+    auto const start = std::chrono::steady_clock::now();
+    for (int i = 0; i != repetitions; ++i) {
+      f();
+    }
+    std::chrono::duration<double, std::milli> const elapsed{
+      std::chrono::steady_clock::now() - start};
+    return elapsed.count() / repetitions;
+  }
+}
+
+int
+main(int argc, char* argv[])
+{
+  std::size_t const nsecondaries = argc > 1 ? std::stoul(argv[1]) : 200;
+  std::size_t const nelements = argc > 2 ? std::stoul(argv[2]) : 20'000;
+  int const repetitions{5};
+
+  std::vector<std::vector<Hit>> secondaries(nsecondaries);
+  std::vector<std::vector<Hit> const*> in;
+  for (std::size_t i = 0; i != nsecondaries; ++i) {
+    auto& hits = secondaries[i];
+    hits.resize(nelements);
+    for (std::size_t j = 0; j != nelements; ++j) {
+      hits[j] = Hit{static_cast<int>(j), static_cast<int>(i), 1. * j, 1. * i};
+    }
+    in.push_back(&hits);
+  }
+
+  std::vector<Hit> serial;
+  std::vector<std::size_t> serial_offsets;
+  auto const serial_ms = time_ms(
+    [&] {
+      serial.clear();
+      serial.shrink_to_fit();
+      art::flattenCollections(in, serial, serial_offsets);
+    },
+    repetitions);
+
+  std::vector<Hit> parallel;
+  std::vector<std::size_t> parallel_offsets;
+  auto const parallel_ms = time_ms(
+    [&] {
+      parallel.clear();
+      parallel.shrink_to_fit();
+      art::flattenCollectionsInParallel(in, parallel, parallel_offsets);
+    },
+    repetitions);
+
+  std::cout << "Secondaries: " << nsecondaries
+            << "  elements per secondary: " << nelements << '\n'
+            << "flattenCollections:           " << serial_ms << " ms\n"
+            << "flattenCollectionsInParallel: " << parallel_ms << " ms\n";
+
+  bool const same = serial.size() == parallel.size() &&
+                    serial_offsets == parallel_offsets &&
+                    std::equal(serial.cbegin(),
+                               serial.cend(),
+                               parallel.cbegin(),
+                               [](Hit const& a, Hit const& b) {
+                                 return a.channel == b.channel &&
+                                        a.tdc == b.tdc;
+                               });
+  return same ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+#define BOOST_TEST_MODULE (ProcessHistoryCache_t)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Persistency/Provenance/ProcessHistoryCache.h"
+#include "art/Persistency/Provenance/ProcessHistoryRegistry.h"
+#include "art/Version/GetReleaseVersion.h"
+#include "canvas/Persistency/Provenance/ProcessHistory.h"
+#include "fhiclcpp/ParameterSet.h"
+
+#include <string>
+
+using namespace art;
+using namespace std::string_literals;
+using fhicl::ParameterSet;
+
+namespace {
+  ProcessConfiguration
+  makeProcessConfiguration(std::string const& process_name)
+  {
+    ParameterSet processParams;
+    processParams.put("process_name", process_name);
+    return ProcessConfiguration{
+      process_name, processParams.id(), getReleaseVersion()};
+  }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ProcessHistoryCacheTest)
+
+BOOST_AUTO_TEST_CASE(lookup)
+{
+  auto const empty = ProcessHistoryCache::get(ProcessHistoryID{});
+  BOOST_TEST_REQUIRE(empty != nullptr);
+  BOOST_TEST(empty->empty());
+
+  ProcessHistory ph;
+  ph.push_back(makeProcessConfiguration("p1"));
+  BOOST_TEST(ProcessHistoryCache::get(ph.id()) == nullptr);
+
+  ProcessHistoryRegistry::emplace(ph.id(), ph);
+  auto const cached = ProcessHistoryCache::get(ph.id());
+  BOOST_TEST_REQUIRE(cached != nullptr);
+  BOOST_TEST(*cached == ph);
+  BOOST_TEST(ProcessHistoryCache::get(ph.id()) == cached);
+}
+
+BOOST_AUTO_TEST_CASE(extension)
+{
+  auto const p2 = makeProcessConfiguration("p2");
+  auto const& empty = *ProcessHistoryCache::get(ProcessHistoryID{});
+  auto const& extended = ProcessHistoryCache::extend(empty, p2);
+  BOOST_TEST_REQUIRE(extended.size() == 1u);
+  BOOST_TEST(extended.data().back() == p2);
+  BOOST_TEST(&ProcessHistoryCache::extend(empty, p2) == &extended);
+
+  // The extension is registered, and may be found by its ID.
+  ProcessHistory registered;
+  BOOST_TEST(ProcessHistoryRegistry::get(extended.id(), registered));
+  BOOST_TEST(registered == extended);
+  BOOST_TEST(ProcessHistoryCache::get(extended.id()) == &extended);
+
+  // A different process configuration is a different extension.
+  auto const& other =
+    ProcessHistoryCache::extend(empty, makeProcessConfiguration("p3"));
+  BOOST_TEST(&other != &extended);
+  BOOST_TEST(other.id() != extended.id());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,70 @@
+#define BOOST_TEST_MODULE (PaddedPerScheduleContainer_t)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Utilities/PaddedPerScheduleContainer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+
+using art::PaddedPerScheduleContainer;
+using art::ScheduleID;
+
+BOOST_AUTO_TEST_SUITE(PaddedPerScheduleContainer_t)
+
+BOOST_AUTO_TEST_CASE(layout)
+{
+  PaddedPerScheduleContainer<int> c(4);
+  BOOST_TEST(c.is_valid());
+  BOOST_TEST(c.size() == 4u);
+  auto const first = reinterpret_cast<std::uintptr_t>(&c[ScheduleID{0}]);
+  auto const second = reinterpret_cast<std::uintptr_t>(&c[ScheduleID{1}]);
+  BOOST_TEST(first % art::detail::cache_line_size == 0u);
+  BOOST_TEST(second - first >= art::detail::cache_line_size);
+}
+
+BOOST_AUTO_TEST_CASE(access_and_iteration)
+{
+  PaddedPerScheduleContainer<int> c;
+  BOOST_TEST(!c.is_valid());
+  c.resize(3);
+  BOOST_CHECK_THROW(c.resize(5), art::Exception);
+  c[ScheduleID{0}] = 1;
+  c[ScheduleID{1}] = 2;
+  c.at(ScheduleID{2}) = 3;
+  BOOST_CHECK_THROW(c.at(ScheduleID{3}), std::out_of_range);
+  BOOST_TEST(std::accumulate(c.cbegin(), c.cend(), 0) == 6);
+  int sum{};
+  for (auto const& i : c) {
+    sum += i;
+  }
+  BOOST_TEST(sum == 6);
+}
+
+BOOST_AUTO_TEST_CASE(copy_and_move)
+{
+  PaddedPerScheduleContainer<int> c(2);
+  c[ScheduleID{0}] = 1;
+  c[ScheduleID{1}] = 2;
+  auto copy = c;
+  BOOST_TEST(copy.size() == 2u);
+  BOOST_TEST(copy[ScheduleID{1}] == 2);
+  copy[ScheduleID{1}] = 4;
+  BOOST_TEST(c[ScheduleID{1}] == 2);
+
+  auto moved = std::move(copy);
+  BOOST_TEST(moved[ScheduleID{1}] == 4);
+  BOOST_TEST(!copy.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(non_movable)
+{
+  PaddedPerScheduleContainer<std::atomic<std::size_t>> counters(2);
+  ++counters[ScheduleID{0}];
+  counters[ScheduleID{1}] += 2;
+  BOOST_TEST(counters[ScheduleID{0}].load() == 1u);
+  BOOST_TEST(counters[ScheduleID{1}].load() == 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
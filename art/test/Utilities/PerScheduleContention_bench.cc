@@ -0,0 +1,139 @@
+// ======================================================================
+// Contention micro-benchmark for per-schedule data.
+//
+// Each of N tasks (one per "schedule", N = 64 by default) increments
+// its own counter a fixed number of times.  The counters are held in:
+//
+//   - a single shared std::atomic (worst case, true sharing),
+//   - a PerScheduleContainer (adjacent entries share cache lines),
+//   - a PaddedPerScheduleContainer (one cache line per entry), and
+//   - ShardedCounters (one shard per thread, summed when read).
+//
+// Usage: PerScheduleContention_bench [nthreads [increments-per-thread]]
+// ======================================================================
+
+#include "art/Utilities/PaddedPerScheduleContainer.h"
+#include "art/Utilities/PerScheduleContainer.h"
+#include "art/Utilities/ScheduleID.h"
+#include "art/Utilities/ShardedCounters.h"
+#include "tbb/blocked_range.h"
+#include "tbb/global_control.h"
+#include "tbb/parallel_for.h"
+#include "tbb/partitioner.h"
+#include "tbb/task_arena.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace art;
+
+namespace {
+
+  template <typename F>
+  double
+  time_per_increment(std::size_t const nthreads,
+                     std::size_t const nincrements,
+                     F increment)
+  {
+    tbb::task_arena arena{static_cast<int>(nthreads)};
+    auto const start = std::chrono::steady_clock::now();
+    arena.execute([=] {
+      tbb::parallel_for(
+        tbb::blocked_range<std::size_t>{0, nthreads, 1},
+        [=](auto const& r) {
+          for (auto i = r.begin(); i != r.end(); ++i) {
+            ScheduleID const sid{static_cast<ScheduleID::id_type>(i)};
+            for (std::size_t j = 0; j != nincrements; ++j) {
+              increment(sid);
+            }
+          }
+        },
+        tbb::simple_partitioner{});
+    });
+    std::chrono::duration<double, std::nano> const elapsed{
+      std::chrono::steady_clock::now() - start};
+    return elapsed.count() / (nthreads * nincrements);
+  }
+
+  void
+  report(std::string const& name, double const ns, std::size_t const total)
+  {
+    std::cout << std::left << std::setw(30) << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(2) << ns
+              << " ns/increment  (total: " << total << ")\n";
+  }
+
+}
+
+int
+main(int argc, char* argv[])
+{
+  std::size_t const nthreads = argc > 1 ? std::stoul(argv[1]) : 64;
+  std::size_t const nincrements = argc > 2 ? std::stoul(argv[2]) : 1 << 18;
+  auto const n = static_cast<ScheduleID::size_type>(nthreads);
+  tbb::global_control const control{
+    tbb::global_control::max_allowed_parallelism, nthreads};
+
+  std::cout << "Threads: " << nthreads
+            << "  increments per thread: " << nincrements << '\n';
+  std::size_t const expected{nthreads * nincrements};
+
+  {
+    std::atomic<std::size_t> shared{};
+    auto const ns = time_per_increment(
+      nthreads, nincrements, [&shared](ScheduleID) {
+        shared.fetch_add(1, std::memory_order_relaxed);
+      });
+    report("shared std::atomic", ns, shared.load());
+    if (shared.load() != expected) {
+      return 1;
+    }
+  }
+
+  {
+    PerScheduleContainer<std::atomic<std::size_t>> counters(n);
+    auto const ns = time_per_increment(
+      nthreads, nincrements, [&counters](ScheduleID const sid) {
+        counters[sid].fetch_add(1, std::memory_order_relaxed);
+      });
+    std::size_t total{};
+    for (auto const& c : counters) {
+      total += c.load();
+    }
+    report("PerScheduleContainer", ns, total);
+    if (total != expected) {
+      return 1;
+    }
+  }
+
+  {
+    PaddedPerScheduleContainer<std::atomic<std::size_t>> counters(n);
+    auto const ns = time_per_increment(
+      nthreads, nincrements, [&counters](ScheduleID const sid) {
+        counters[sid].fetch_add(1, std::memory_order_relaxed);
+      });
+    std::size_t total{};
+    for (auto const& c : counters) {
+      total += c.load();
+    }
+    report("PaddedPerScheduleContainer", ns, total);
+    if (total != expected) {
+      return 1;
+    }
+  }
+
+  {
+    ShardedCounters counters{1};
+    auto const ns = time_per_increment(
+      nthreads, nincrements, [&counters](ScheduleID) { ++counters[0]; });
+    report("ShardedCounters", ns, counters.load(0));
+    if (counters.load(0) != expected) {
+      return 1;
+    }
+  }
+}
@@ -0,0 +1,72 @@
+#define BOOST_TEST_MODULE (PluginIndex_t)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Utilities/PluginIndex.h"
+#include "art/Utilities/PluginSuffixes.h"
+#include "boost/filesystem.hpp"
+#include "cetlib_except/exception.h"
+
+#include <cstdlib>
+#include <string>
+
+using art::PluginIndex;
+using art::Suffixes;
+namespace bfs = boost::filesystem;
+
+namespace {
+  bfs::path const cache_dir{bfs::absolute("PluginIndex_t.d")};
+
+  unsigned
+  cache_files()
+  {
+    unsigned result{};
+    if (bfs::exists(cache_dir)) {
+      for (auto const& entry : bfs::directory_iterator{cache_dir}) {
+        auto const name = entry.path().filename().string();
+        result += name.rfind("plugins_tool_", 0) == 0;
+      }
+    }
+    return result;
+  }
+
+  struct CacheDir {
+    CacheDir()
+    {
+      bfs::remove_all(cache_dir);
+      setenv("ART_PLUGIN_CACHE_DIR", cache_dir.c_str(), 1);
+    }
+  };
+} // namespace
+
+BOOST_GLOBAL_FIXTURE(CacheDir);
+
+BOOST_AUTO_TEST_SUITE(PluginIndex_t)
+
+BOOST_AUTO_TEST_CASE(lookup)
+{
+  PluginIndex const index{Suffixes::tool()};
+  BOOST_TEST(cache_files() == 1u);
+  BOOST_TEST(index.getSymbolByLibspec<void*>("ClassTool", "makeTool") !=
+             nullptr);
+  BOOST_TEST(index.getSymbolByLibspec<void*>("ClassTool", "noSuchSymbol") ==
+             nullptr);
+  BOOST_CHECK_THROW(index.getSymbolByLibspec<void*>("NoSuchTool", "makeTool"),
+                    cet::exception);
+}
+
+BOOST_AUTO_TEST_CASE(rebuild)
+{
+  // The index is built once per process...
+  bfs::remove_all(cache_dir);
+  PluginIndex const cached{Suffixes::tool()};
+  BOOST_TEST(cache_files() == 0u);
+
+  // ...unless it is explicitly rebuilt.
+  PluginIndex::rebuildCache();
+  PluginIndex const rebuilt{Suffixes::tool()};
+  BOOST_TEST(cache_files() == 1u);
+  BOOST_TEST(rebuilt.getSymbolByLibspec<void*>("FunctionTool",
+                                               "toolFunction") != nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
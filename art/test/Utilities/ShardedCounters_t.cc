@@ -0,0 +1,60 @@
+#define BOOST_TEST_MODULE (ShardedCounters_t)
+#include "boost/test/unit_test.hpp"
+
+#include "art/Utilities/ShardedCounters.h"
+#include "canvas/Utilities/Exception.h"
+#include "tbb/parallel_for.h"
+
+using art::ShardedCounters;
+
+BOOST_AUTO_TEST_SUITE(ShardedCounters_t)
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+  ShardedCounters counts{5};
+  BOOST_TEST(counts.ncounters() == 5u);
+  BOOST_TEST(counts.nshards() >= 1u);
+  BOOST_CHECK_THROW(ShardedCounters{ShardedCounters::max_counters + 1},
+                    art::Exception);
+}
+
+BOOST_AUTO_TEST_CASE(serial)
+{
+  ShardedCounters counts{2, 4};
+  auto first = counts[0];
+  auto second = counts[1];
+  ++first;
+  ++first;
+  second += 5;
+  BOOST_TEST(first.load() == 2u);
+  BOOST_TEST(second.load() == 5u);
+  counts.reset();
+  BOOST_TEST(first.load() == 0u);
+  BOOST_TEST(second.load() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent)
+{
+  constexpr std::size_t n{100'000};
+  ShardedCounters counts{2, 8};
+  tbb::parallel_for(std::size_t{}, n, [&counts](std::size_t const i) {
+    ++counts[0];
+    if (i % 2 == 0) {
+      ++counts[1];
+    }
+  });
+  BOOST_TEST(counts.load(0) == n);
+  BOOST_TEST(counts.load(1) == n / 2);
+}
+
+BOOST_AUTO_TEST_CASE(single_shard)
+{
+  constexpr std::size_t n{100'000};
+  ShardedCounters counts{1, 1};
+  BOOST_TEST(counts.nshards() == 1u);
+  tbb::parallel_for(
+    std::size_t{}, n, [&counts](std::size_t) { ++counts[0]; });
+  BOOST_TEST(counts.load(0) == n);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
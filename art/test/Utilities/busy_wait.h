@@ -0,0 +1,27 @@
+#ifndef art_test_Utilities_busy_wait_h
+#define art_test_Utilities_busy_wait_h
+// vim: set sw=2 expandtab :
+
+#include <chrono>
+
+namespace art::test {
+  // Occupy the calling thread for (at least) the given duration,
+  // emulating the work done by a real module.  Used by test modules
+  // that need to keep a schedule busy without sleeping.
+  inline void
+  busy_wait(std::chrono::nanoseconds const duration)
+  {
+    if (duration.count() == 0) {
+      return;
+    }
+    auto const end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+    }
+  }
+}
+
+#endif /* art_test_Utilities_busy_wait_h */
+
+// Local Variables:
+// mode: c++
+// End: